@@ -5,6 +5,7 @@
  * ==================================================================== */
 
 #include <math.h>
+#include <stddef.h>
 
 /**
  * @brief Clausen function \f$\operatorname{Cl}_2(\theta) = \operatorname{Im}(\operatorname{Li}_2(e^{i\theta}))\f$
@@ -202,3 +203,31 @@ long double cl2l(long double x)
 
    return sgn*h;
 }
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_2(x[i])
+ * @param n number of elements
+ */
+void cl2_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl2(x[i]);
+   }
+}
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(x)\f$ for an array of arguments with long double precision
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_2(x[i])
+ * @param n number of elements
+ */
+void cl2l_v(const long double* restrict x, long double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl2l(x[i]);
+   }
+}
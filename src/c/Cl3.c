@@ -5,6 +5,7 @@
  * ==================================================================== */
 
 #include <math.h>
+#include <stddef.h>
 
 /**
  * @brief Clausen function \f$\operatorname{Cl}_3(\theta) = \operatorname{Re}(\operatorname{Li}_3(e^{i\theta}))\f$
@@ -219,3 +220,31 @@ long double cl3l(long double x)
 
    return h;
 }
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_3(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_3(x[i])
+ * @param n number of elements
+ */
+void cl3_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl3(x[i]);
+   }
+}
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_3(x)\f$ for an array of arguments with long double precision
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_3(x[i])
+ * @param n number of elements
+ */
+void cl3l_v(const long double* restrict x, long double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl3l(x[i]);
+   }
+}
@@ -5,6 +5,7 @@
  * ==================================================================== */
 
 #include <math.h>
+#include <stddef.h>
 
 /**
  * @brief Clausen function \f$\operatorname{Cl}_4(\theta) = \operatorname{Im}(\operatorname{Li}_4(e^{i\theta}))\f$
@@ -201,3 +202,31 @@ long double cl4l(long double x)
 
    return sgn*h;
 }
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_4(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_4(x[i])
+ * @param n number of elements
+ */
+void cl4_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl4(x[i]);
+   }
+}
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_4(x)\f$ for an array of arguments with long double precision
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_4(x[i])
+ * @param n number of elements
+ */
+void cl4l_v(const long double* restrict x, long double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl4l(x[i]);
+   }
+}
@@ -5,6 +5,7 @@
  * ==================================================================== */
 
 #include <math.h>
+#include <stddef.h>
 
 /**
  * @brief Clausen function \f$\operatorname{Cl}_5(\theta) = \operatorname{Re}(\operatorname{Li}_5(e^{i\theta}))\f$
@@ -216,3 +217,31 @@ long double cl5l(long double x)
 
    return h;
 }
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_5(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_5(x[i])
+ * @param n number of elements
+ */
+void cl5_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl5(x[i]);
+   }
+}
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_5(x)\f$ for an array of arguments with long double precision
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_5(x[i])
+ * @param n number of elements
+ */
+void cl5l_v(const long double* restrict x, long double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl5l(x[i]);
+   }
+}
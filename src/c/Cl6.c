@@ -5,6 +5,7 @@
  * ==================================================================== */
 
 #include <math.h>
+#include <stddef.h>
 
 /**
  * @brief Clausen function \f$\operatorname{Cl}_6(\theta) = \operatorname{Im}(\operatorname{Li}_6(e^{i\theta}))\f$
@@ -220,3 +221,31 @@ long double cl6l(long double x)
 
    return sgn*h;
 }
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_6(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_6(x[i])
+ * @param n number of elements
+ */
+void cl6_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl6(x[i]);
+   }
+}
+
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_6(x)\f$ for an array of arguments with long double precision
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Cl_6(x[i])
+ * @param n number of elements
+ */
+void cl6l_v(const long double* restrict x, long double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = cl6l(x[i]);
+   }
+}
@@ -7,6 +7,7 @@
 #include <complex.h>
 #include <float.h>
 #include <math.h>
+#include <stddef.h>
 #include "fast_clog.h"
 
 
@@ -552,3 +553,102 @@ long double _Complex cli2l(long double _Complex z)
 
    return (long double)sgn * sum + rest;
 }
+
+
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ for an array of arguments with single precision
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Li_2(x[i])
+ * @param n number of elements
+ */
+void li2f_v(const float* restrict x, float* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = li2f(x[i]);
+   }
+}
+
+
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Li_2(x[i])
+ * @param n number of elements
+ */
+void li2_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = li2(x[i]);
+   }
+}
+
+
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ for an array of arguments with long double precision
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Li_2(x[i])
+ * @param n number of elements
+ */
+void li2l_v(const long double* restrict x, long double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = li2l(x[i]);
+   }
+}
+
+
+/**
+ * @brief Complex dilogarithm \f$\operatorname{Li}_2(z)\f$ for an array of arguments with single precision
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli2f_v(const float* restrict re, const float* restrict im,
+             float* restrict res_re, float* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const float _Complex result = cli2f(re[i] + I*im[i]);
+      res_re[i] = crealf(result);
+      res_im[i] = cimagf(result);
+   }
+}
+
+
+/**
+ * @brief Complex dilogarithm \f$\operatorname{Li}_2(z)\f$ for an array of arguments
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli2_v(const double* restrict re, const double* restrict im,
+            double* restrict res_re, double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const double _Complex result = cli2(re[i] + I*im[i]);
+      res_re[i] = creal(result);
+      res_im[i] = cimag(result);
+   }
+}
+
+
+/**
+ * @brief Complex dilogarithm \f$\operatorname{Li}_2(z)\f$ for an array of arguments with long double precision
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli2l_v(const long double* restrict re, const long double* restrict im,
+             long double* restrict res_re, long double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const long double _Complex result = cli2l(re[i] + I*im[i]);
+      res_re[i] = creall(result);
+      res_im[i] = cimagl(result);
+   }
+}
@@ -7,6 +7,7 @@
 #include <complex.h>
 #include <float.h>
 #include <math.h>
+#include <stddef.h>
 #include "fast_clog.h"
 
 /// Li_3(x) for x in [-1,0]
@@ -333,3 +334,55 @@ long double _Complex cli3l(long double _Complex z)
 
    return rest + sum;
 }
+
+
+/**
+ * @brief Real trilogarithm \f$\operatorname{Li}_3(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Li_3(x[i])
+ * @param n number of elements
+ */
+void li3_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = li3(x[i]);
+   }
+}
+
+
+/**
+ * @brief Complex trilogarithm \f$\operatorname{Li}_3(z)\f$ for an array of arguments
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli3_v(const double* restrict re, const double* restrict im,
+            double* restrict res_re, double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const double _Complex result = cli3(re[i] + I*im[i]);
+      res_re[i] = creal(result);
+      res_im[i] = cimag(result);
+   }
+}
+
+
+/**
+ * @brief Complex trilogarithm \f$\operatorname{Li}_3(z)\f$ for an array of arguments with long double precision
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli3l_v(const long double* restrict re, const long double* restrict im,
+             long double* restrict res_re, long double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const long double _Complex result = cli3l(re[i] + I*im[i]);
+      res_re[i] = creall(result);
+      res_im[i] = cimagl(result);
+   }
+}
@@ -7,6 +7,7 @@
 #include <complex.h>
 #include <float.h>
 #include <math.h>
+#include <stddef.h>
 #include "fast_clog.h"
 
 /// Li_4(x) for x in [-1,0]
@@ -393,3 +394,55 @@ long double _Complex cli4l(long double _Complex z)
 
    return sgn*sum + r;
 }
+
+
+/**
+ * @brief Real polylogarithm \f$\operatorname{Li}_4(x)\f$ for an array of arguments
+ * @param x array of real arguments
+ * @param res array of results, res[i] = Li_4(x[i])
+ * @param n number of elements
+ */
+void li4_v(const double* restrict x, double* restrict res, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      res[i] = li4(x[i]);
+   }
+}
+
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_4(z)\f$ for an array of arguments
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli4_v(const double* restrict re, const double* restrict im,
+            double* restrict res_re, double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const double _Complex result = cli4(re[i] + I*im[i]);
+      res_re[i] = creal(result);
+      res_im[i] = cimag(result);
+   }
+}
+
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_4(z)\f$ for an array of arguments with long double precision
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli4l_v(const long double* restrict re, const long double* restrict im,
+             long double* restrict res_re, long double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const long double _Complex result = cli4l(re[i] + I*im[i]);
+      res_re[i] = creall(result);
+      res_im[i] = cimagl(result);
+   }
+}
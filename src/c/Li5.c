@@ -7,6 +7,7 @@
 #include <complex.h>
 #include <float.h>
 #include <math.h>
+#include <stddef.h>
 #include "fast_clog.h"
 
 
@@ -253,3 +254,41 @@ long double _Complex cli5l(long double _Complex z)
 
    return rest + sum;
 }
+
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_5(z)\f$ for an array of arguments
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli5_v(const double* restrict re, const double* restrict im,
+            double* restrict res_re, double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const double _Complex result = cli5(re[i] + I*im[i]);
+      res_re[i] = creal(result);
+      res_im[i] = cimag(result);
+   }
+}
+
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_5(z)\f$ for an array of arguments with long double precision
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param res_re array of real parts of the results
+ * @param res_im array of imaginary parts of the results
+ * @param n number of elements
+ */
+void cli5l_v(const long double* restrict re, const long double* restrict im,
+             long double* restrict res_re, long double* restrict res_im, size_t n)
+{
+   for (size_t i = 0; i < n; ++i) {
+      const long double _Complex result = cli5l(re[i] + I*im[i]);
+      res_re[i] = creall(result);
+      res_im[i] = cimagl(result);
+   }
+}
@@ -6,6 +6,8 @@
 
 #pragma once
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -88,6 +90,91 @@ void cli6_c(double re, double im, double* res_re, double* res_im);
 /** complex polylogarithm with n=6 with long double precision */
 void cli6l_c(long double re, long double im, long double* res_re, long double* res_im);
 
+/*
+ * Batch versions: evaluate the function for the n arguments x[i]
+ * (complex: re[i] + i*im[i]) and write the results to res[i]
+ * (complex: res_re[i] + i*res_im[i]).  The loops are defined next to
+ * the scalar functions, so that they can be inlined.
+ */
+
+/** Clausen function with n=2 for an array of arguments */
+void cl2_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=3 for an array of arguments */
+void cl3_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=4 for an array of arguments */
+void cl4_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=5 for an array of arguments */
+void cl5_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=6 for an array of arguments */
+void cl6_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=2 for an array of arguments with long double precision */
+void cl2l_v(const long double* x, long double* res, size_t n);
+
+/** Clausen function with n=3 for an array of arguments with long double precision */
+void cl3l_v(const long double* x, long double* res, size_t n);
+
+/** Clausen function with n=4 for an array of arguments with long double precision */
+void cl4l_v(const long double* x, long double* res, size_t n);
+
+/** Clausen function with n=5 for an array of arguments with long double precision */
+void cl5l_v(const long double* x, long double* res, size_t n);
+
+/** Clausen function with n=6 for an array of arguments with long double precision */
+void cl6l_v(const long double* x, long double* res, size_t n);
+
+/** real polylogarithm with n=2 (dilogarithm) for an array of arguments with single precision */
+void li2f_v(const float* x, float* res, size_t n);
+
+/** real polylogarithm with n=2 (dilogarithm) for an array of arguments */
+void li2_v(const double* x, double* res, size_t n);
+
+/** real polylogarithm with n=3 (trilogarithm) for an array of arguments */
+void li3_v(const double* x, double* res, size_t n);
+
+/** real polylogarithm with n=4 for an array of arguments */
+void li4_v(const double* x, double* res, size_t n);
+
+/** real polylogarithm with n=2 (dilogarithm) for an array of arguments with long double precision */
+void li2l_v(const long double* x, long double* res, size_t n);
+
+/** complex polylogarithm with n=2 (dilogarithm) for an array of arguments with single precision */
+void cli2f_v(const float* re, const float* im, float* res_re, float* res_im, size_t n);
+
+/** complex polylogarithm with n=2 (dilogarithm) for an array of arguments */
+void cli2_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=2 (dilogarithm) for an array of arguments with long double precision */
+void cli2l_v(const long double* re, const long double* im, long double* res_re, long double* res_im, size_t n);
+
+/** complex polylogarithm with n=3 (trilogarithm) for an array of arguments */
+void cli3_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=3 (trilogarithm) for an array of arguments with long double precision */
+void cli3l_v(const long double* re, const long double* im, long double* res_re, long double* res_im, size_t n);
+
+/** complex polylogarithm with n=4 for an array of arguments */
+void cli4_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=4 for an array of arguments with long double precision */
+void cli4l_v(const long double* re, const long double* im, long double* res_re, long double* res_im, size_t n);
+
+/** complex polylogarithm with n=5 for an array of arguments */
+void cli5_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=5 for an array of arguments with long double precision */
+void cli5l_v(const long double* re, const long double* im, long double* res_re, long double* res_im, size_t n);
+
+/** complex polylogarithm with n=6 for an array of arguments */
+void cli6_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=6 for an array of arguments with long double precision */
+void cli6l_v(const long double* re, const long double* im, long double* res_re, long double* res_im, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
@@ -11,16 +11,17 @@
 #include "Cl4.hpp"
 #include "Cl5.hpp"
 #include "Cl6.hpp"
+#include "cl_detail.hpp"
+#include "inv_pow.hpp"
+#include "trig_sum.hpp"
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace polylogarithm {
 
-namespace {
-
-constexpr double PI = 3.14159265358979324;
-constexpr double PI2 = 2*PI;
-constexpr int64_t N_THRESH = 9; // threshold to switch between series
+namespace detail {
+namespace cl {
 
 // (-1)^k B_{2k}/(2k)! = 2*(-1)^(2*k + 1)*Zeta[2*k]/(2*Pi)^(2*k)
 // where B_{2k} are the even Bernoulli numbers
@@ -78,37 +79,8 @@ constexpr double B[] = {
    -2.7084630535382438e-321,-6.8606170609008831e-323
 };
 
-// Binomial coefficents, [ binomial(n,k) for n=0:7, k=0:7 ]
-constexpr int binomial[8][8] = {
-   {1, 0,  0,  0,   0,   0,  0,  0},
-   {1, 1,  0,  0,   0,   0,  0,  0},
-   {1, 2,  1,  0,   0,   0,  0,  0},
-   {1, 3,  3,  1,   0,   0,  0,  0},
-   {1, 4,  6,  4,   1,   0,  0,  0},
-   {1, 5, 10, 10,   5,   1,  0,  0},
-   {1, 6, 15, 20,  15,   6,  1,  0},
-   {1, 7, 21, 35,  35,  21,  7,  1}
-};
-
-// 1/n! for n = 0,...,8
-constexpr double inverse_factorial[] = {
-   1.0, 1.0, 1.0/2, 1.0/6, 1.0/24, 1.0/120, 1.0/720, 1.0/5040, 1.0/40320
-};
-
-// zeta(n) for n = 2,...,9
-constexpr double zeta[] = {
-   1.6449340668482264, 1.2020569031595943, 1.0823232337111382,
-   1.0369277551433699, 1.0173430619844491, 1.0083492773819228,
-   1.0040773561979443, 1.0020083928260822
-};
-
-constexpr bool is_even(int64_t n) noexcept
-{
-   return n % 2 == 0;
-}
-
 // range-reduces x in [0,pi] for odd n
-void range_reduce_odd(double& x) noexcept
+POLYLOGARITHM_INLINE void range_reduce_odd(double& x) noexcept
 {
    if (x < 0) {
       x = -x;
@@ -126,7 +98,7 @@ void range_reduce_odd(double& x) noexcept
 }
 
 // range-reduces x in [0,pi] for even n, retuns sign
-double range_reduce_even(double& x) noexcept
+POLYLOGARITHM_INLINE double range_reduce_even(double& x) noexcept
 {
    double sgn = 1.0;
 
@@ -150,7 +122,7 @@ double range_reduce_even(double& x) noexcept
 }
 
 // range-reduces x to be in [0,pi], returns sign
-double range_reduce(int64_t n, double& x) noexcept
+POLYLOGARITHM_INLINE double range_reduce(int64_t n, double& x) noexcept
 {
    double sgn = 1.0;
 
@@ -163,26 +135,8 @@ double range_reduce(int64_t n, double& x) noexcept
    return sgn;
 }
 
-// returns P_n(x)
-double pcal(int64_t n, double x) noexcept
-{
-   double sum = 0;
-   const auto x2 = x*x;
-
-   for (int64_t i = 3; i <= n; i += 2) {
-      const double sign = is_even((n - 1)/2 + (i - 1)/2) ? 1.0 : -1.0;
-      sum = x2*sum + sign*zeta[i - 2]*inverse_factorial[n - i];
-   }
-
-   if (is_even(n)) {
-      sum *= x;
-   }
-
-   return sum;
-}
-
 // returns N_n(x) from Eq.(2.11)
-double ncal(int64_t n, double x) noexcept
+POLYLOGARITHM_INLINE double ncal(int64_t n, double x) noexcept
 {
    double sum = 0, old_sum = 0;
    const double xn1 = std::pow(x, n + 1);
@@ -201,55 +155,16 @@ double ncal(int64_t n, double x) noexcept
    return (xn1/(n + 1) + sum)/(n + 1);
 }
 
-// returns sum in Eq.(2.13)
-double nsum(int64_t n, double x) noexcept
-{
-    double sum = 0;
-    double xn = 1;
-
-    for (int64_t i = 0; i <= n - 3; ++i) {
-       sum += binomial[n - 2][i]*xn*ncal(n - 2 - i, x);
-       xn *= -x;
-    }
-
-    return sum + xn*ncal(0, x);
-}
-
 // returns Cl(n,x) using the naive series expansion
-double cl_series(int64_t n, double x) noexcept
+POLYLOGARITHM_INLINE double cl_series(int64_t n, double x)
 {
-   const auto eps = std::numeric_limits<double>::epsilon();
-   const auto kmax = static_cast<int64_t>(std::ceil(std::pow(eps, -1.0/n)));
-   const double co = std::cos(x);
-   double sum = 0;
+   const bool sine = is_even(n);
 
-   if (is_even(n)) {
-      double si = std::sin(x);
-      double si2 = 0;  // sin((n-2)*x)
-      double si1 = si; // sin((n-1)*x)
-      sum = si;
-      for (int64_t k = 2; k <= kmax; ++k) {
-         si = 2*co*si1 - si2; // sin(n*x)
-         si2 = si1;
-         si1 = si;
-         sum += si*std::pow(k, -n);
-      }
-   } else {
-      double co2 = 1;  // cos((n-2)*x)
-      double co1 = co; // cos((n-1)*x)
-      sum = co;
-      for (int64_t k = 2; k <= kmax; ++k) {
-         const double con = 2*co*co1 - co2; // cos(n*x)
-         co2 = co1;
-         co1 = con;
-         sum += con*std::pow(k, -n);
-      }
-   }
-
-   return sum;
+   return trig::trig_sum(*inv_pow(n), sine, std::cos(x), sine ? std::sin(x) : 0);
 }
 
-} // anonymous namespace
+} // namespace cl
+} // namespace detail
 
 /**
  * @brief Standard Clausen function \f$\operatorname{Cl}_n(x)\f$ for \f$n>0\f$
@@ -266,16 +181,17 @@ double cl_series(int64_t n, double x) noexcept
  * functions Cl_n(0)(n >= 2)", Bit Numer Math 50, 193-206
  * (2010) https://doi.org/10.1007/s10543-009-0246-8].
  */
-double Cl(int64_t n, double x)
+POLYLOGARITHM_INLINE double Cl(int64_t n, double x)
 {
-   static_assert(N_THRESH - 1 <= sizeof(binomial)/sizeof(binomial[0]),
+   static_assert(detail::cl::N_THRESH - 1 <= sizeof(detail::cl::binomial)/sizeof(detail::cl::binomial[0]),
                  "not enough pre-computed binomial numbers");
-   static_assert(N_THRESH - 1 <= sizeof(binomial[0])/sizeof(binomial[0][0]),
+   static_assert(detail::cl::N_THRESH - 1 <= sizeof(detail::cl::binomial[0])/sizeof(detail::cl::binomial[0][0]),
                  "not enough pre-computed binomial numbers");
-   static_assert(N_THRESH - 1 <= sizeof(inverse_factorial)/sizeof(inverse_factorial[0]),
+   static_assert(detail::cl::N_THRESH - 1 <= sizeof(detail::cl::inverse_factorial)/sizeof(detail::cl::inverse_factorial[0]),
                  "not enough pre-computed inverse factorials");
-   static_assert(N_THRESH - 1 <= sizeof(zeta)/sizeof(zeta[0]),
+   static_assert(detail::cl::N_THRESH - 1 <= sizeof(detail::cl::zeta)/sizeof(detail::cl::zeta[0]),
                  "not enough pre-computed zeta values");
+   static_assert(detail::cl::N_THRESH == 9, "cl_wu<n> must be dispatched for all 6 < n <= N_THRESH");
 
    if (n < 1) {
       return std::numeric_limits<double>::quiet_NaN();
@@ -293,30 +209,66 @@ double Cl(int64_t n, double x)
       return Cl6(x);
    }
 
-   const auto sgn = range_reduce(n, x);
+   const auto sgn = detail::cl::range_reduce(n, x);
 
-   if (is_even(n) && (x == 0 || x == PI)) {
+   if (detail::cl::is_even(n) && (x == 0 || x == detail::cl::PI)) {
       return 0;
    }
 
-   if (n <= N_THRESH) {
-      const double sign1 = is_even((n + 1)/2) ? 1.0 : -1.0;
-
-      // first line in Eq.(2.13)
-      const double term1 = x == 0 ? 0
-         : sign1*std::pow(x, n - 1)*inverse_factorial[n - 1] *
-           std::log(2*std::sin(x/2));
-
-      const double sign2 = is_even(n/2) ? 1.0 : -1.0;
+   // orders below N_THRESH with loop bounds fixed at compile time
+   switch (n) {
+   case 7: return sgn*detail::cl::cl_wu<7>(x);
+   case 8: return sgn*detail::cl::cl_wu<8>(x);
+   case 9: return sgn*detail::cl::cl_wu<9>(x);
+   default: break;
+   }
 
-      // second line in Eq.(2.13)
-      const double term2 = pcal(n, x) - sign2*inverse_factorial[n - 2]*nsum(n, x);
+   return sgn*detail::cl::cl_series(n, x);
+}
 
-      // Eq.(2.13)
-      return sgn*(term1 + term2);
+/**
+ * @brief Standard Clausen function \f$\operatorname{Cl}_n(x)\f$ on a uniform grid
+ * @param n degree of Standard Clausen function
+ * @param x0 first angle
+ * @param h grid spacing
+ * @param count number of grid points
+ * @param out array of size count, filled with \f$\operatorname{Cl}_n(x_0 + k h)\f$
+ * @author Alexander Voigt
+ *
+ * For \f$n > 9\f$, where Cl(int64_t, double) sums the series
+ * expansion, the weights \f$k^{-n}\f$ are computed once for the whole
+ * grid and \f$\cos(x)\f$ and \f$\sin(x)\f$ are obtained from the
+ * previous grid point by the angle-addition theorem, such that no
+ * range reduction and no trigonometric function call is needed for
+ * most grid points.  For \f$n \leq 9\f$ Cl(int64_t, double) is called
+ * for each grid point.
+ */
+POLYLOGARITHM_INLINE void Cl_grid(int64_t n, double x0, double h, std::size_t count, double* out)
+{
+   if (n <= detail::cl::N_THRESH) {
+      for (std::size_t j = 0; j < count; ++j) {
+         out[j] = Cl(n, x0 + j*h);
+      }
+      return;
    }
 
-   return sgn*cl_series(n, x);
+   detail::trig::series_grid(n, detail::cl::is_even(n), x0, h, count, out);
+}
+
+/**
+ * @brief Standard Clausen function \f$\operatorname{Cl}_n(x)\f$ on a uniform grid
+ * @param n degree of Standard Clausen function
+ * @param x0 first angle
+ * @param h grid spacing
+ * @param count number of grid points
+ * @return vector of \f$\operatorname{Cl}_n(x_0 + k h)\f$ for \f$k = 0, \ldots, \text{count} - 1\f$
+ * @author Alexander Voigt
+ */
+POLYLOGARITHM_INLINE std::vector<double> Cl_grid(int64_t n, double x0, double h, std::size_t count)
+{
+   std::vector<double> out(count);
+   Cl_grid(n, x0, h, count, out.data());
+   return out;
 }
 
 } // namespace polylogarithm
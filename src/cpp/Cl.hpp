@@ -5,11 +5,107 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
+#include "Cl1.hpp"
+#include "Cl2.hpp"
+#include "Cl3.hpp"
+#include "Cl4.hpp"
+#include "Cl5.hpp"
+#include "Cl6.hpp"
+#include "cl_detail.hpp"
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
+#include <vector>
 
 namespace polylogarithm {
 
 /// Standard Clausen function for arbitrary integer n
 double Cl(int64_t, double);
 
+/// Standard Clausen function for arbitrary integer n on the grid x0 + k*h, k = 0, ..., count - 1
+void Cl_grid(int64_t n, double x0, double h, std::size_t count, double* out);
+
+/// Standard Clausen function for arbitrary integer n on the grid x0 + k*h, k = 0, ..., count - 1
+std::vector<double> Cl_grid(int64_t n, double x0, double h, std::size_t count);
+
+namespace detail {
+namespace cl {
+
+/// Cl(N, x) for 6 < N <= N_THRESH with loop bounds fixed at compile time
+template <int64_t N>
+double Cl_fixed(double x, std::true_type) noexcept
+{
+   const double sgn = range_reduce(N, x);
+
+   if (is_even(N) && (x == 0 || x == PI)) {
+      return 0;
+   }
+
+   return sgn*cl_wu<N>(x);
+}
+
+/// Cl(N, x) for all other orders
+template <int64_t N>
+double Cl_fixed(double x, std::false_type)
+{
+   return polylogarithm::Cl(N, x);
+}
+
+} // namespace cl
+} // namespace detail
+
+/**
+ * Standard Clausen function for integer n known at compile time.  For
+ * 6 < N <= 9 the function of Eq.(2.13) of Wu et al. is evaluated
+ * directly, without the dispatch on n of Cl(int64_t, double).  Larger
+ * N fall back to the series expansion of Cl(int64_t, double).
+ */
+template <int64_t N>
+double Cl(double x)
+{
+   return detail::cl::Cl_fixed<N>(
+      x, std::integral_constant<bool, (N > 6 && N <= detail::cl::N_THRESH)>());
+}
+
+template <>
+inline double Cl<1>(double x)
+{
+   return Cl1(x);
+}
+
+template <>
+inline double Cl<2>(double x)
+{
+   return Cl2(x);
+}
+
+template <>
+inline double Cl<3>(double x)
+{
+   return Cl3(x);
+}
+
+template <>
+inline double Cl<4>(double x)
+{
+   return Cl4(x);
+}
+
+template <>
+inline double Cl<5>(double x)
+{
+   return Cl5(x);
+}
+
+template <>
+inline double Cl<6>(double x)
+{
+   return Cl6(x);
+}
+
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl.cpp"
+#endif
@@ -16,7 +16,7 @@ namespace polylogarithm {
  * @return \f$\operatorname{Cl}_1(\theta)\f$
  * @author Alexander Voigt
  */
-double Cl1(double x) noexcept
+POLYLOGARITHM_INLINE double Cl1(double x) noexcept
 {
    const double PI = 3.14159265358979324;
    const double PI2 = 2*PI;
@@ -5,6 +5,7 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 
 namespace polylogarithm {
 
@@ -12,3 +13,7 @@ namespace polylogarithm {
 double Cl1(double) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl1.cpp"
+#endif
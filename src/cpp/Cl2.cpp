@@ -5,10 +5,81 @@
 // ====================================================================
 
 #include "Cl2.hpp"
+#include "cl_coeffs.hpp"
 #include <cmath>
 
 namespace polylogarithm {
 
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(\theta) = \operatorname{Im}(\operatorname{Li}_2(e^{i\theta}))\f$ with single precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_2(\theta)\f$
+ * @author Alexander Voigt
+ * @note Implemented as polynomial approximation with a maximum
+ * absolute error of approximately 4e-7.
+ */
+POLYLOGARITHM_INLINE float Cl2(float x) noexcept
+{
+   const float PI = 3.14159265f;
+   const float PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
+   float sgn = 1;
+
+   if (x < 0) {
+      x = -x;
+      sgn = -1;
+   }
+
+   // 2*PI = p0 + p1 with p0 exactly representable
+   const float p0 = 6.28125f;
+   const float p1 = 0.00193530718f;
+
+   if (x >= PI2) {
+      const float k = std::floor(x/PI2);
+      x = (x - k*p0) - k*p1;
+      if (x < 0) {
+         x = -x;
+         sgn = -sgn;
+      }
+   }
+
+   if (x > PI) {
+      x = (p0 - x) + p1;
+      sgn = -sgn;
+   }
+
+   if (x == 0 || x == PI) {
+      return 0;
+   }
+
+   float h = 0;
+
+   if (x < PIH) {
+      const float P[] = {
+         1.38889359e-02f, 6.93455157e-05f,
+         8.49086554e-07f
+      };
+      const float y = x*x;
+      const float y2 = y*y;
+      const float p = P[0] + y * P[1] + y2 * P[2];
+      h = x*(1 - std::log(x) + y*p);
+   } else {
+      const float P[] = {
+         6.40057021e-01f, -4.44878767e-02f,
+         -1.25615434e-03f, -6.76184716e-05f,
+         -4.59115355e-06f, -3.50086656e-07f
+      };
+      const float y = (3.140625f - x) + 9.67653589793e-4f; // PI - x
+      const float z = y*y - PI28;
+      const float z2 = z*z;
+      const float z4 = z2*z2;
+      const float p = P[0] + z * P[1] + z2 * (P[2] + z * P[3]) +
+         z4 * (P[4] + z * P[5]);
+      h = y*p;
+   }
+
+   return sgn*h;
+}
+
 /**
  * @brief Clausen function \f$\operatorname{Cl}_2(\theta) = \operatorname{Im}(\operatorname{Li}_2(e^{i\theta}))\f$
  * @param x real angle
@@ -16,7 +87,7 @@ namespace polylogarithm {
  * @author Alexander Voigt
  * @note Implemented as rational function approximation.
  */
-double Cl2(double x) noexcept
+POLYLOGARITHM_INLINE double Cl2(double x) noexcept
 {
    const double PI = 3.14159265358979324;
    const double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -45,14 +116,8 @@ double Cl2(double x) noexcept
    double h = 0;
 
    if (x < PIH) {
-      const double P[] = {
-         1.3888888888888889e-02, -4.3286930203743071e-04,
-         3.2779814789973427e-06, -3.6001540369575084e-09
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -3.6166589746694121e-02,
-         3.6015827281202639e-04, -8.3646182842184428e-07
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl2_p_lo;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl2_q_lo;
       const double y = x*x;
       const double y2 = y*y;
       const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
@@ -60,16 +125,8 @@ double Cl2(double x) noexcept
 
       h = x*(1 - std::log(x) + y*p/q);
    } else {
-      const double P[] = {
-         6.4005702446195512e-01, -2.0641655351338783e-01,
-         2.4175305223497718e-02, -1.2355955287855728e-03,
-         2.5649833551291124e-05, -1.4783829128773320e-07
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -2.5299102015666356e-01,
-         2.2148751048467057e-02, -7.8183920462457496e-04,
-         9.5432542196310670e-06, -1.8184302880448247e-08
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl2_p_hi;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl2_q_hi;
       const double y = PI - x;
       const double z = y*y - PI28;
       const double z2 = z*z;
@@ -85,6 +142,84 @@ double Cl2(double x) noexcept
    return sgn*h;
 }
 
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(\theta) = \operatorname{Im}(\operatorname{Li}_2(e^{i\theta}))\f$ with reduced accuracy
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_2(\theta)\f$
+ * @author Alexander Voigt
+ * @note Implemented as polynomial approximation with a maximum error
+ * of approximately 1e-10.  For |x| < 1e8 the argument is reduced
+ * without fmod.
+ */
+POLYLOGARITHM_INLINE double Cl2_fast(double x) noexcept
+{
+   const double PI = 3.14159265358979324;
+   const double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
+   // 2*PI = p0 + p1 with p0 exactly representable
+   const double p0 = 6.28125;
+   const double p1 = 0.0019353071795864769253;
+   double sgn = 1;
+
+   if (x < 0) {
+      x = -x;
+      sgn = -1;
+   }
+
+   if (x >= PI2) {
+      if (x < 1e8) {
+         // cheaper than fmod, k*p0 is exact
+         const double k = std::floor(x/PI2);
+         x = (x - k*p0) - k*p1;
+         if (x < 0) {
+            x = -x;
+            sgn = -sgn;
+         }
+      } else {
+         x = std::fmod(x, PI2);
+      }
+   }
+
+   if (x > PI) {
+      x = (p0 - x) + p1;
+      sgn = -sgn;
+   }
+
+   if (x == 0 || x == PI) {
+      return 0;
+   }
+
+   double h = 0;
+
+   if (x < PIH) {
+      const double P[] = {
+         1.3888888062552111e-02, 6.9447198537926321e-05,
+         7.8435690719346393e-07, 1.2787910640692898e-08
+      };
+      const double y = x*x;
+      const double y2 = y*y;
+      const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
+
+      h = x*(1 - std::log(x) + y*p);
+   } else {
+      const double P[] = {
+         6.4005702447107204e-01, -4.4487873924993593e-02,
+        -1.2561912716695053e-03, -6.7628144984638780e-05,
+        -4.5263598435111900e-06, -3.4105945863110382e-07,
+        -2.8403618503509036e-08, -2.4670936606322793e-09
+      };
+      const double y = PI - x;
+      const double z = y*y - PI28;
+      const double z2 = z*z;
+      const double z4 = z2*z2;
+      const double p = P[0] + z * P[1] + z2 * (P[2] + z * P[3]) +
+         z4 * (P[4] + z * P[5] + z2 * (P[6] + z * P[7]));
+
+      h = y*p;
+   }
+
+   return sgn*h;
+}
+
 /**
  * @brief Clausen function \f$\operatorname{Cl}_2(\theta) = \operatorname{Im}(\operatorname{Li}_2(e^{i\theta}))\f$ with long double precision
  * @param x real angle
@@ -95,7 +230,7 @@ double Cl2(double x) noexcept
  * error of approximately 3.26e-41 (for long double and quadruple
  * precision).
  */
-long double Cl2(long double x) noexcept
+POLYLOGARITHM_INLINE long double Cl2(long double x) noexcept
 {
    const long double PI = 3.14159265358979323846264338327950288L;
    const long double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -5,13 +5,24 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 
 namespace polylogarithm {
 
+/// Clausen function with n=2 with single precision
+float Cl2(float) noexcept;
+
 /// Clausen function with n=2
 double Cl2(double) noexcept;
 
+/// Clausen function with n=2 with reduced accuracy of about 1e-10
+double Cl2_fast(double) noexcept;
+
 /// Clausen function with n=2 with long double precision
 long double Cl2(long double) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl2.cpp"
+#endif
@@ -0,0 +1,237 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "Cl2Table.hpp"
+#include "Cl2.hpp"
+#include <cmath>
+#include <limits>
+#include <memory>
+
+namespace polylogarithm {
+
+namespace detail {
+namespace cl2table {
+
+   /// size of a cache line in bytes
+   constexpr std::size_t cache_line_size = 64;
+
+   /// lower bound x0 of the table in units of the segment width
+   constexpr double x0_in_widths = 40;
+
+   /**
+    * Computes the coefficients a[0..N-1] of the polynomial
+    * sum_m a[m]*t^m, which interpolates f(x(t)) at the N Chebyshev
+    * nodes t_k in [-1,1].
+    */
+   template <std::size_t N, typename F>
+   void chebyshev_interpolation(F f, long double (&a)[N])
+   {
+      const long double PI = 3.14159265358979323846264338327950288L;
+
+      long double fk[N], tk[N], c[N];
+
+      for (std::size_t k = 0; k < N; ++k) {
+         tk[k] = std::cos(PI*(k + 0.5L)/N);
+         fk[k] = f(tk[k]);
+      }
+
+      // Chebyshev coefficients c_j
+      for (std::size_t j = 0; j < N; ++j) {
+         long double sum = 0;
+         for (std::size_t k = 0; k < N; ++k) {
+            sum += fk[k]*std::cos(PI*j*(k + 0.5L)/N);
+         }
+         c[j] = (j == 0 ? 1 : 2)*sum/N;
+      }
+
+      // monomial coefficients of T_j(t) from T_{j+1} = 2 t T_j - T_{j-1}
+      long double Tm[N] = {}, T[N] = {}, Tp[N] = {};
+      T[0] = 1;
+
+      for (std::size_t m = 0; m < N; ++m) {
+         a[m] = 0;
+      }
+
+      for (std::size_t j = 0; j < N; ++j) {
+         for (std::size_t m = 0; m < N; ++m) {
+            a[m] += c[j]*T[m];
+         }
+         if (j == 0) {
+            Tp[0] = 0;
+            for (std::size_t m = 1; m < N; ++m) {
+               Tp[m] = T[m - 1];
+            }
+         } else {
+            Tp[0] = -Tm[0];
+            for (std::size_t m = 1; m < N; ++m) {
+               Tp[m] = 2*T[m - 1] - Tm[m];
+            }
+         }
+         for (std::size_t m = 0; m < N; ++m) {
+            Tm[m] = T[m];
+            T[m] = Tp[m];
+         }
+      }
+   }
+
+   /// Cl2(x) from the table c with n segments on [x0, pi]
+   inline double cl2_table(double x, double x0, double inv_h, const double* c, int n) noexcept
+   {
+      const double PI = 3.14159265358979324;
+      const double PI2 = 2*PI;
+      double sgn = 1;
+
+      // the segment index of a non-finite angle is undefined
+      if (!std::isfinite(x)) {
+         return std::numeric_limits<double>::quiet_NaN();
+      }
+
+      if (x < 0) {
+         x = -x;
+         sgn = -1;
+      }
+
+      if (x >= PI2) {
+         x = std::fmod(x, PI2);
+      }
+
+      if (x > PI) {
+         const double p0 = 6.28125;
+         const double p1 = 0.0019353071795864769253;
+         x = (p0 - x) + p1;
+         sgn = -sgn;
+      }
+
+      if (x == 0 || x == PI) {
+         return 0;
+      }
+
+      if (x < x0) {
+         return sgn*Cl2(x);
+      }
+
+      const double u = (x - x0)*inv_h;
+      // conversion to a signed integer is faster than to std::size_t
+      int i = static_cast<int>(u);
+      if (i >= n) {
+         i = n - 1;
+      }
+
+      const double t = 2*(u - i) - 1;
+      const double t2 = t*t;
+      const double t4 = t2*t2;
+      c += Cl2Table::n_coeffs*i;
+      const double p = c[0] + t * c[1] + t2 * (c[2] + t * c[3]) +
+         t4 * (c[4] + t * c[5] + t2 * (c[6] + t * c[7]));
+      const double y = (3.140625 - x) + 9.6765358979323846e-4; // PI - x
+
+      return sgn*y*p;
+   }
+
+} // namespace cl2table
+} // namespace detail
+
+// the definition would be duplicated in every translation unit in
+// header-only mode
+#ifndef POLYLOGARITHM_HEADER_ONLY
+constexpr std::size_t Cl2Table::n_coeffs;
+#endif
+
+/**
+ * @brief Creates a table for the Clausen function Cl2(x)
+ * @param n_segments_ number of segments (at least 1)
+ *
+ * The table occupies n_segments_ cache lines.  With the default of
+ * 512 segments (32 KiB) the maximum relative error on [0, pi] is
+ * approximately 1e-15 for any number of segments.
+ */
+POLYLOGARITHM_INLINE Cl2Table::Cl2Table(std::size_t n_segments_)
+   : n_segments(n_segments_ == 0 ? 1 : n_segments_)
+{
+   static_assert(n_coeffs*sizeof(double) == detail::cl2table::cache_line_size,
+                 "one segment must fill one cache line");
+
+   const long double PI = 3.14159265358979323846264338327950288L;
+
+   x0 = static_cast<double>(detail::cl2table::x0_in_widths*PI/(n_segments + detail::cl2table::x0_in_widths));
+   inv_h = n_segments/(3.14159265358979324 - x0);
+
+   const std::size_t n_table = n_coeffs*n_segments;
+   const std::size_t n_pad = detail::cl2table::cache_line_size/sizeof(double) - 1;
+
+   storage.resize(n_table + n_pad);
+
+   void* ptr = storage.data();
+   std::size_t space = storage.size()*sizeof(double);
+   double* table = static_cast<double*>(
+      std::align(detail::cl2table::cache_line_size, n_table*sizeof(double), ptr, space));
+   coeffs = table;
+
+   for (std::size_t i = 0; i < n_segments; ++i) {
+      long double a[n_coeffs];
+
+      // Cl2(x)/(pi - x) on segment i with x = x0 + (i + (t + 1)/2)*h
+      detail::cl2table::chebyshev_interpolation([this, i, PI] (long double t) {
+         const long double x = x0 + (i + 0.5L*(t + 1))/inv_h;
+         return Cl2(x)/(PI - x);
+      }, a);
+
+      for (std::size_t m = 0; m < n_coeffs; ++m) {
+         table[n_coeffs*i + m] = static_cast<double>(a[m]);
+      }
+   }
+}
+
+/**
+ * @brief Returns the memory footprint of the table
+ * @return size of the table in bytes, including the padding for the
+ * alignment
+ */
+POLYLOGARITHM_INLINE std::size_t Cl2Table::memory_footprint() const noexcept
+{
+   return storage.capacity()*sizeof(double);
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(\theta) = \operatorname{Im}(\operatorname{Li}_2(e^{i\theta}))\f$
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_2(\theta)\f$
+ *
+ * Uses the same argument reduction as Cl2(double).
+ */
+POLYLOGARITHM_INLINE double Cl2Table::operator()(double x) const noexcept
+{
+   return detail::cl2table::cl2_table(x, x0, inv_h, coeffs, static_cast<int>(n_segments));
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(\theta)\f$ for an array
+ * @param x array of real angles
+ * @param out array of size n, filled with \f$\operatorname{Cl}_2(\theta)\f$
+ * @param n number of elements
+ */
+POLYLOGARITHM_INLINE void Cl2Table::operator()(const double* x, double* out, std::size_t n) const noexcept
+{
+   const int n_seg = static_cast<int>(n_segments);
+
+   for (std::size_t i = 0; i < n; ++i) {
+      out[i] = detail::cl2table::cl2_table(x[i], x0, inv_h, coeffs, n_seg);
+   }
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(\theta)\f$ for a vector
+ * @param x vector of real angles
+ * @return vector of \f$\operatorname{Cl}_2(\theta)\f$
+ */
+POLYLOGARITHM_INLINE std::vector<double> Cl2Table::operator()(const std::vector<double>& x) const
+{
+   std::vector<double> out(x.size());
+   (*this)(x.data(), out.data(), x.size());
+   return out;
+}
+
+} // namespace polylogarithm
@@ -0,0 +1,74 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <cstddef>
+#include <vector>
+
+namespace polylogarithm {
+
+/**
+ * Clausen function Cl2(x) evaluated from a precomputed table.
+ *
+ * The interval [x0, pi] is divided into equidistant segments.  On each
+ * segment Cl2(x)/(pi - x) is approximated by a polynomial of degree 7,
+ * obtained from Chebyshev interpolation.  The 8 coefficients of a
+ * segment fill exactly one cache line and the table is aligned to the
+ * cache line size, so that an evaluation costs one table lookup and a
+ * polynomial of degree 7 without division.  Below x0 the logarithmic
+ * singularity is handled analytically by Cl2(double).  The lower bound
+ * x0 is chosen proportional to the segment width such that the
+ * interpolation error is of the order of the double precision epsilon.
+ *
+ * A Cl2Table is an alternative backend to Cl2(double), which can be
+ * chosen at runtime for throughput-bound applications that evaluate
+ * Cl2 at many angles.
+ */
+class Cl2Table {
+public:
+   /// number of polynomial coefficients per segment
+   static constexpr std::size_t n_coeffs = 8;
+
+   /// creates a table with the given number of segments
+   explicit Cl2Table(std::size_t n_segments = 512);
+
+   Cl2Table(const Cl2Table&) = delete;
+   Cl2Table& operator=(const Cl2Table&) = delete;
+   Cl2Table(Cl2Table&&) = default;
+   Cl2Table& operator=(Cl2Table&&) = default;
+
+   /// returns the number of segments
+   std::size_t segments() const noexcept { return n_segments; }
+
+   /// returns the lower bound x0 of the tabulated interval [x0, pi]
+   double lower_bound() const noexcept { return x0; }
+
+   /// returns the memory footprint of the table in bytes
+   std::size_t memory_footprint() const noexcept;
+
+   /// Clausen function Cl2(x)
+   double operator()(double) const noexcept;
+
+   /// Clausen function Cl2(x) for an array of n doubles
+   void operator()(const double* x, double* out, std::size_t n) const noexcept;
+
+   /// Clausen function Cl2(x) for a vector of doubles
+   std::vector<double> operator()(const std::vector<double>&) const;
+
+private:
+   std::size_t n_segments{};
+   double x0{};                  ///< lower bound of the tabulated interval
+   double inv_h{};               ///< 1/(segment width)
+   std::vector<double> storage;  ///< table including padding for the alignment
+   const double* coeffs{};       ///< cache line aligned table in storage
+};
+
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl2Table.cpp"
+#endif
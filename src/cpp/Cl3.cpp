@@ -5,10 +5,75 @@
 // ====================================================================
 
 #include "Cl3.hpp"
+#include "cl_coeffs.hpp"
 #include <cmath>
 
 namespace polylogarithm {
 
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_3(\theta) = \operatorname{Re}(\operatorname{Li}_3(e^{i\theta}))\f$ with single precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_3(\theta)\f$
+ * @author Alexander Voigt
+ * @note Implemented as polynomial approximation with a maximum
+ * absolute error of approximately 4e-7.
+ */
+POLYLOGARITHM_INLINE float Cl3(float x) noexcept
+{
+   const float PI = 3.14159265f;
+   const float PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
+   const float zeta3 = 1.20205690f;
+
+   if (x < 0) {
+      x = -x;
+   }
+
+   // 2*PI = p0 + p1 with p0 exactly representable
+   const float p0 = 6.28125f;
+   const float p1 = 0.00193530718f;
+
+   if (x >= PI2) {
+      const float k = std::floor(x/PI2);
+      x = std::abs((x - k*p0) - k*p1);
+   }
+
+   if (x > PI) {
+      x = (p0 - x) + p1;
+   }
+
+   if (x == 0) {
+      return zeta3;
+   }
+
+   float h = 0;
+
+   if (x < PIH) {
+      const float P[] = {
+         -7.49999992e-01f, -3.47224501e-03f,
+         -1.15524540e-05f, -1.06911617e-07f
+      };
+      const float y = x*x;
+      const float y2 = y*y;
+      const float p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
+      h = zeta3 + y*(p + 0.5f*std::log(x));
+   } else {
+      const float P[] = {
+         -4.90170249e-01f, 3.20028498e-01f,
+         -1.11219361e-02f, -2.09325953e-04f,
+         -8.51564249e-06f, -4.76590945e-07f
+      };
+      const float y = (3.140625f - x) + 9.67653589793e-4f; // PI - x
+      const float z = y*y - PI28;
+      const float z2 = z*z;
+      const float z4 = z2*z2;
+      const float p = P[0] + z * P[1] + z2 * (P[2] + z * P[3]) +
+         z4 * (P[4] + z * P[5]);
+      h = p;
+   }
+
+   return h;
+}
+
 /**
  * @brief Clausen function \f$\operatorname{Cl}_3(\theta) = \operatorname{Re}(\operatorname{Li}_3(e^{i\theta}))\f$
  * @param x real angle
@@ -16,7 +81,7 @@ namespace polylogarithm {
  * @author Alexander Voigt
  * @note Implementation as rational function approximation.
  */
-double Cl3(double x) noexcept
+POLYLOGARITHM_INLINE double Cl3(double x) noexcept
 {
    const double PI = 3.14159265358979324;
    const double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -43,30 +108,16 @@ double Cl3(double x) noexcept
    double h = 0;
 
    if (x < PIH) {
-      const double P[] = {
-         -7.5000000000000001e-01,  1.5707637881835541e-02,
-         -3.5426736843494423e-05, -2.4408931585123682e-07
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -2.5573146805410089e-02,
-         1.5019774853075050e-04, -1.0648552418111624e-07
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl3_p_lo;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl3_q_lo;
       const double y = x*x;
       const double y2 = y*y;
       const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
       const double q = Q[0] + y * Q[1] + y2 * (Q[2] + y * Q[3]);
       h = zeta3 + y*(p/q + 0.5*std::log(x));
    } else {
-      const double P[] = {
-         -4.9017024647634973e-01, 4.1559155224660940e-01,
-         -7.9425531417806701e-02, 5.9420152260602943e-03,
-         -1.8302227163540190e-04, 1.8027408929418533e-06
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -1.9495887541644712e-01,
-         1.2059410236484074e-02, -2.5235889467301620e-04,
-         1.0199322763377861e-06,  1.9612106499469264e-09
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl3_p_hi;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl3_q_hi;
       const double y = PI - x;
       const double z = y*y - PI28;
       const double z2 = z*z;
@@ -88,7 +139,7 @@ double Cl3(double x) noexcept
  * @author Alexander Voigt
  * @note Implementation as rational function approximation.
  */
-long double Cl3(long double x) noexcept
+POLYLOGARITHM_INLINE long double Cl3(long double x) noexcept
 {
    const long double PI = 3.14159265358979323846264338327950288L;
    const long double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -5,9 +5,13 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 
 namespace polylogarithm {
 
+/// Clausen function with n=3 with single precision
+float Cl3(float) noexcept;
+
 /// Clausen function with n=3
 double Cl3(double) noexcept;
 
@@ -15,3 +19,7 @@ double Cl3(double) noexcept;
 long double Cl3(long double) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl3.cpp"
+#endif
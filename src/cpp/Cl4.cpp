@@ -5,10 +5,82 @@
 // ====================================================================
 
 #include "Cl4.hpp"
+#include "cl_coeffs.hpp"
 #include <cmath>
 
 namespace polylogarithm {
 
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_4(\theta) = \operatorname{Im}(\operatorname{Li}_4(e^{i\theta}))\f$ with single precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_4(\theta)\f$
+ * @author Alexander Voigt
+ * @note Implemented as polynomial approximation with a maximum
+ * absolute error of approximately 4e-7.
+ */
+POLYLOGARITHM_INLINE float Cl4(float x) noexcept
+{
+   const float PI = 3.14159265f;
+   const float PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
+   const float zeta3 = 1.20205690f;
+   float sgn = 1;
+
+   if (x < 0) {
+      x = -x;
+      sgn = -1;
+   }
+
+   // 2*PI = p0 + p1 with p0 exactly representable
+   const float p0 = 6.28125f;
+   const float p1 = 0.00193530718f;
+
+   if (x >= PI2) {
+      const float k = std::floor(x/PI2);
+      x = (x - k*p0) - k*p1;
+      if (x < 0) {
+         x = -x;
+         sgn = -sgn;
+      }
+   }
+
+   if (x > PI) {
+      x = (p0 - x) + p1;
+      sgn = -sgn;
+   }
+
+   if (x == 0 || x == PI) {
+      return 0;
+   }
+
+   float h = 0;
+
+   if (x < PIH) {
+      const float P[] = {
+         -3.05555593e-01f, -6.94359785e-04f,
+         -1.70904305e-06f
+      };
+      const float y = x*x;
+      const float y2 = y*y;
+      const float p = P[0] + y * P[1] + y2 * P[2];
+      h = x*(zeta3 + y*(p + 1.0f/6*std::log(x)));
+   } else {
+      const float P[] = {
+         7.62239119e-01f, -1.10265388e-01f,
+         2.18195497e-03f, 2.87324993e-05f,
+         8.96347807e-07f
+      };
+      const float y = (3.140625f - x) + 9.67653589793e-4f; // PI - x
+      const float z = y*y - PI28;
+      const float z2 = z*z;
+      const float z4 = z2*z2;
+      const float p = P[0] + z * P[1] + z2 * (P[2] + z * P[3]) +
+         z4 * P[4];
+      h = y*p;
+   }
+
+   return sgn*h;
+}
+
 /**
  * @brief Clausen function \f$\operatorname{Cl}_4(\theta) = \operatorname{Im}(\operatorname{Li}_4(e^{i\theta}))\f$
  * @param x real angle
@@ -16,7 +88,7 @@ namespace polylogarithm {
  * @author Alexander Voigt
  * @note Implemented as rational function approximation.
  */
-double Cl4(double x) noexcept
+POLYLOGARITHM_INLINE double Cl4(double x) noexcept
 {
    const double PI = 3.14159265358979324;
    const double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -46,30 +118,16 @@ double Cl4(double x) noexcept
    double h = 0;
 
    if (x < PIH) {
-      const double P[] = {
-         -3.0555555555555556e-01,  6.0521392328447206e-03,
-         -1.9587493942041528e-05, -3.1137343767030358e-08
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -2.2079728398400851e-02,
-         1.0887447112236682e-04, -6.1847621370547954e-08
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl4_p_lo;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl4_q_lo;
       const double y = x*x;
       const double y2 = y*y;
       const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
       const double q = Q[0] + y * Q[1] + y2 * (Q[2] + y * Q[3]);
       h = x*(zeta3 + y*(p/q + 1./6*std::log(x)));
    } else {
-      const double P[] = {
-         7.6223911686491336e-01, -2.4339587368267260e-01,
-         2.8715364937979943e-02, -1.5368612510964667e-03,
-         3.6261044225761673e-05, -2.8557977333851308e-07
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -1.7465715261403233e-01,
-         9.5439417991615653e-03, -1.7325070821666274e-04,
-         5.9283675098376635e-07,  9.4127575773361230e-10
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl4_p_hi;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl4_q_hi;
       const double y = PI - x;
       const double z = y*y - PI28;
       const double z2 = z*z;
@@ -91,7 +149,7 @@ double Cl4(double x) noexcept
  * @author Alexander Voigt
  * @note Implemented as rational function approximation.
  */
-long double Cl4(long double x) noexcept
+POLYLOGARITHM_INLINE long double Cl4(long double x) noexcept
 {
    const long double PI = 3.14159265358979323846264338327950288L;
    const long double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -5,9 +5,13 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 
 namespace polylogarithm {
 
+/// Clausen function with n=4 with single precision
+float Cl4(float) noexcept;
+
 /// Clausen function with n=4
 double Cl4(double) noexcept;
 
@@ -15,3 +19,7 @@ double Cl4(double) noexcept;
 long double Cl4(long double) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl4.cpp"
+#endif
@@ -5,10 +5,78 @@
 // ====================================================================
 
 #include "Cl5.hpp"
+#include "cl_coeffs.hpp"
 #include <cmath>
 
 namespace polylogarithm {
 
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_5(\theta) = \operatorname{Re}(\operatorname{Li}_5(e^{i\theta}))\f$ with single precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_5(\theta)\f$
+ * @author Alexander Voigt
+ * @note Implemented as polynomial approximation with a maximum
+ * absolute error of approximately 4e-7.
+ */
+POLYLOGARITHM_INLINE float Cl5(float x) noexcept
+{
+   const float PI = 3.14159265f;
+   const float PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
+   const float zeta5 = 1.03692776f;
+
+   if (x < 0) {
+      x = -x;
+   }
+
+   // 2*PI = p0 + p1 with p0 exactly representable
+   const float p0 = 6.28125f;
+   const float p1 = 0.00193530718f;
+
+   if (x >= PI2) {
+      const float k = std::floor(x/PI2);
+      x = std::abs((x - k*p0) - k*p1);
+   }
+
+   if (x > PI) {
+      x = (p0 - x) + p1;
+   }
+
+   if (x == 0) {
+      return zeta5;
+   }
+
+   float h = 0;
+
+   if (x < PIH) {
+      const float P[] = {
+         1.03692776e+00f, -6.01028461e-01f,
+         8.68055791e-02f, 1.15719585e-04f,
+         2.14776475e-07f
+      };
+      const float y = x*x;
+      const float y2 = y*y;
+      const float y4 = y2*y2;
+      const float p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]) +
+         y4 * P[4];
+      h = p - 1.0f/24*y2*std::log(x);
+   } else {
+      const float P[] = {
+         -4.59301127e-01f, 3.81119561e-01f,
+         -2.75663430e-02f, 3.63654907e-04f,
+         3.58894664e-06f, 9.20671186e-08f
+      };
+      const float y = (3.140625f - x) + 9.67653589793e-4f; // PI - x
+      const float z = y*y - PI28;
+      const float z2 = z*z;
+      const float z4 = z2*z2;
+      const float p = P[0] + z * P[1] + z2 * (P[2] + z * P[3]) +
+         z4 * (P[4] + z * P[5]);
+      h = p;
+   }
+
+   return h;
+}
+
 /**
  * @brief Clausen function \f$\operatorname{Cl}_5(\theta) = \operatorname{Re}(\operatorname{Li}_5(e^{i\theta}))\f$
  * @param x real angle
@@ -16,7 +84,7 @@ namespace polylogarithm {
  * @author Alexander Voigt
  * @note Implementation as rational function approximation.
  */
-double Cl5(double x) noexcept
+POLYLOGARITHM_INLINE double Cl5(double x) noexcept
 {
    const double PI = 3.14159265358979324;
    const double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -43,31 +111,16 @@ double Cl5(double x) noexcept
    double h = 0;
 
    if (x < PIH) {
-      const double P[] = {
-         1.0369277551433699e+00, -6.1354800479984468e-01,
-         9.4076401395712763e-02, -9.4056155866704436e-04
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -1.2073698633244778e-02,
-         1.3703409625482991e-05, -1.9701280330628469e-09,
-         2.1944550184416500e-11
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl5_p_lo;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl5_q_lo;
       const double y = x*x;
       const double y2 = y*y;
       const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
       const double q = Q[0] + y * Q[1] + y2 * (Q[2] + y * Q[3] + y2 * Q[4]);
       h = p/q - 1./24*y2*std::log(x);
    } else {
-      const double P[] = {
-         -4.5930112735784898e-01, 4.3720705508867954e-01,
-         -7.5895226486465095e-02, 5.2244176912488065e-03,
-         -1.5677716622013956e-04, 1.6641624171748576e-06
-      };
-      const double Q[] = {
-          1.0000000000000000e+00, -1.2211486825401188e-01,
-          3.8940070749313620e-03, -2.2674805547074318e-05,
-         -7.4383354448335299e-08, -3.4131758392216437e-10
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl5_p_hi;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl5_q_hi;
       const double y = PI - x;
       const double z = y*y - PI28;
       const double z2 = z*z;
@@ -89,7 +142,7 @@ double Cl5(double x) noexcept
  * @author Alexander Voigt
  * @note Implementation as a rational function approximation.
  */
-long double Cl5(long double x) noexcept
+POLYLOGARITHM_INLINE long double Cl5(long double x) noexcept
 {
    const long double PI = 3.14159265358979323846264338327950288L;
    const long double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -5,9 +5,13 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 
 namespace polylogarithm {
 
+/// Clausen function with n=5 with single precision
+float Cl5(float) noexcept;
+
 /// Clausen function with n=5
 double Cl5(double) noexcept;
 
@@ -15,3 +19,7 @@ double Cl5(double) noexcept;
 long double Cl5(long double) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl5.cpp"
+#endif
@@ -5,10 +5,81 @@
 // ====================================================================
 
 #include "Cl6.hpp"
+#include "cl_coeffs.hpp"
 #include <cmath>
 
 namespace polylogarithm {
 
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_6(\theta) = \operatorname{Im}(\operatorname{Li}_6(e^{i\theta}))\f$ with single precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_6(\theta)\f$
+ * @author Alexander Voigt
+ * @note Implemented as polynomial approximation with a maximum
+ * absolute error of approximately 4e-7.
+ */
+POLYLOGARITHM_INLINE float Cl6(float x) noexcept
+{
+   const float PI = 3.14159265f;
+   const float PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
+   float sgn = 1;
+
+   if (x < 0) {
+      x = -x;
+      sgn = -1;
+   }
+
+   // 2*PI = p0 + p1 with p0 exactly representable
+   const float p0 = 6.28125f;
+   const float p1 = 0.00193530718f;
+
+   if (x >= PI2) {
+      const float k = std::floor(x/PI2);
+      x = (x - k*p0) - k*p1;
+      if (x < 0) {
+         x = -x;
+         sgn = -sgn;
+      }
+   }
+
+   if (x > PI) {
+      x = (p0 - x) + p1;
+      sgn = -sgn;
+   }
+
+   if (x == 0 || x == PI) {
+      return 0;
+   }
+
+   float h = 0;
+
+   if (x < PIH) {
+      const float P[] = {
+         1.03692775e+00f, -2.00342716e-01f,
+         1.90275859e-02f, 1.66530454e-05f
+      };
+      const float y = x*x;
+      const float y2 = y*y;
+      const float p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
+      h = x*(p - 1.0f/120*y2*std::log(x));
+   } else {
+      const float P[] = {
+         7.95445045e-01f, -1.36233993e-01f,
+         5.58937249e-03f, -5.14200053e-05f,
+         -3.89074220e-07f
+      };
+      const float y = (3.140625f - x) + 9.67653589793e-4f; // PI - x
+      const float z = y*y - PI28;
+      const float z2 = z*z;
+      const float z4 = z2*z2;
+      const float p = P[0] + z * P[1] + z2 * (P[2] + z * P[3]) +
+         z4 * P[4];
+      h = y*p;
+   }
+
+   return sgn*h;
+}
+
 /**
  * @brief Clausen function \f$\operatorname{Cl}_6(\theta) = \operatorname{Im}(\operatorname{Li}_6(e^{i\theta}))\f$
  * @param x real angle
@@ -16,7 +87,7 @@ namespace polylogarithm {
  * @author Alexander Voigt
  * @note Implemented as a rational function approximation.
  */
-double Cl6(double x) noexcept
+POLYLOGARITHM_INLINE double Cl6(double x) noexcept
 {
    const double PI = 3.14159265358979324;
    const double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -45,30 +116,16 @@ double Cl6(double x) noexcept
    double h = 0;
 
    if (x < PIH) {
-      const double P[] = {
-         1.0369277551433699e+00, -2.087195444107175e-01,
-         2.0652251045312954e-02, -1.383438138256840e-04
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -8.0784096827362542e-03,
-         5.8074568862993102e-06, -5.1960620033050114e-10
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl6_p_lo;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl6_q_lo;
       const double y = x*x;
       const double y2 = y*y;
       const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]);
       const double q = Q[0] + y * Q[1] + y2 * (Q[2] + y * Q[3]);
       h = x*(p/q - 1./120*y2*std::log(x));
    } else {
-      const double P[] = {
-         7.9544504578027050e-01, -1.9255025309738589e-01,
-         1.5805208288846591e-02, -5.4175380521534706e-04,
-         6.7577493541009068e-06
-      };
-      const double Q[] = {
-         1.0000000000000000e+00, -7.0798422394109274e-02,
-         7.1744189715634762e-04,  3.9098747334347093e-06,
-         3.5669441618295266e-08,  2.5315391843409925e-10
-      };
+      const auto& P = detail::cl_coeffs::Tables<>::cl6_p_hi;
+      const auto& Q = detail::cl_coeffs::Tables<>::cl6_q_hi;
       const double y = PI - x;
       const double z = y*y - PI28;
       const double z2 = z*z;
@@ -90,7 +147,7 @@ double Cl6(double x) noexcept
  * @author Alexander Voigt
  * @note Implemented as a rational function approximation.
  */
-long double Cl6(long double x) noexcept
+POLYLOGARITHM_INLINE long double Cl6(long double x) noexcept
 {
    const long double PI = 3.14159265358979323846264338327950288L;
    const long double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
@@ -5,9 +5,13 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 
 namespace polylogarithm {
 
+/// Clausen function with n=6 with single precision
+float Cl6(float) noexcept;
+
 /// Clausen function with n=6
 double Cl6(double) noexcept;
 
@@ -15,3 +19,7 @@ double Cl6(double) noexcept;
 long double Cl6(long double) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl6.cpp"
+#endif
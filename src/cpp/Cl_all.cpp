@@ -0,0 +1,136 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "Cl_all.hpp"
+#include "cl_coeffs.hpp"
+#include <cmath>
+#include <limits>
+
+namespace polylogarithm {
+
+/**
+ * @brief Clausen functions \f$\operatorname{Cl}_n(\theta)\f$ for n = 1,...,6
+ * @param x real angle
+ * @return array with \f$\operatorname{Cl}_1(\theta),\ldots,\operatorname{Cl}_6(\theta)\f$
+ * @author Alexander Voigt
+ *
+ * Uses the same rational function approximations as Cl2(), ...,
+ * Cl6(), but performs the range reduction to \f$[0,\pi]\f$ only once
+ * and shares \f$\log(\theta)\f$ and the powers of \f$\theta^2\f$
+ * resp. \f$(\pi-\theta)^2 - \pi^2/8\f$ between all orders.
+ */
+POLYLOGARITHM_INLINE std::array<double, 6> Cl_all(double x) noexcept
+{
+   const double PI = 3.14159265358979324;
+   const double PI2 = 2*PI, PIH = PI/2, PI28 = PI*PI/8;
+   const double zeta3 = 1.2020569031595943;
+   const double zeta5 = 1.0369277551433699;
+   double sgn = 1;
+
+   if (x < 0) {
+      x = -x;
+      sgn = -1;
+   }
+
+   if (x >= PI2) {
+      x = std::fmod(x, PI2);
+   }
+
+   if (x > PI) {
+      const double p0 = 6.28125;
+      const double p1 = 0.0019353071795864769253;
+      x = (p0 - x) + p1;
+      sgn = -sgn;
+   }
+
+   if (x == 0) {
+      return {{ std::numeric_limits<double>::infinity(), 0, zeta3, 0, zeta5, 0 }};
+   }
+
+   const double cl1 = -std::log(2.0*std::sin(0.5*x));
+
+   if (x < PIH) {
+      const auto& P2 = detail::cl_coeffs::Tables<>::cl2_p_lo;
+      const auto& Q2 = detail::cl_coeffs::Tables<>::cl2_q_lo;
+      const auto& P3 = detail::cl_coeffs::Tables<>::cl3_p_lo;
+      const auto& Q3 = detail::cl_coeffs::Tables<>::cl3_q_lo;
+      const auto& P4 = detail::cl_coeffs::Tables<>::cl4_p_lo;
+      const auto& Q4 = detail::cl_coeffs::Tables<>::cl4_q_lo;
+      const auto& P5 = detail::cl_coeffs::Tables<>::cl5_p_lo;
+      const auto& Q5 = detail::cl_coeffs::Tables<>::cl5_q_lo;
+      const auto& P6 = detail::cl_coeffs::Tables<>::cl6_p_lo;
+      const auto& Q6 = detail::cl_coeffs::Tables<>::cl6_q_lo;
+      const double y = x*x;
+      const double y2 = y*y;
+      const double l = std::log(x);
+      const double p2 = P2[0] + y * P2[1] + y2 * (P2[2] + y * P2[3]);
+      const double q2 = Q2[0] + y * Q2[1] + y2 * (Q2[2] + y * Q2[3]);
+      const double p3 = P3[0] + y * P3[1] + y2 * (P3[2] + y * P3[3]);
+      const double q3 = Q3[0] + y * Q3[1] + y2 * (Q3[2] + y * Q3[3]);
+      const double p4 = P4[0] + y * P4[1] + y2 * (P4[2] + y * P4[3]);
+      const double q4 = Q4[0] + y * Q4[1] + y2 * (Q4[2] + y * Q4[3]);
+      const double p5 = P5[0] + y * P5[1] + y2 * (P5[2] + y * P5[3]);
+      const double q5 = Q5[0] + y * Q5[1] + y2 * (Q5[2] + y * Q5[3] + y2 * Q5[4]);
+      const double p6 = P6[0] + y * P6[1] + y2 * (P6[2] + y * P6[3]);
+      const double q6 = Q6[0] + y * Q6[1] + y2 * (Q6[2] + y * Q6[3]);
+
+      return {{
+         cl1,
+         sgn*x*(1 - l + y*p2/q2),
+         zeta3 + y*(p3/q3 + 0.5*l),
+         sgn*x*(zeta3 + y*(p4/q4 + 1./6*l)),
+         p5/q5 - 1./24*y2*l,
+         sgn*x*(p6/q6 - 1./120*y2*l)
+      }};
+   }
+
+   const auto& P2 = detail::cl_coeffs::Tables<>::cl2_p_hi;
+   const auto& Q2 = detail::cl_coeffs::Tables<>::cl2_q_hi;
+   const auto& P3 = detail::cl_coeffs::Tables<>::cl3_p_hi;
+   const auto& Q3 = detail::cl_coeffs::Tables<>::cl3_q_hi;
+   const auto& P4 = detail::cl_coeffs::Tables<>::cl4_p_hi;
+   const auto& Q4 = detail::cl_coeffs::Tables<>::cl4_q_hi;
+   const auto& P5 = detail::cl_coeffs::Tables<>::cl5_p_hi;
+   const auto& Q5 = detail::cl_coeffs::Tables<>::cl5_q_hi;
+   const auto& P6 = detail::cl_coeffs::Tables<>::cl6_p_hi;
+   const auto& Q6 = detail::cl_coeffs::Tables<>::cl6_q_hi;
+   const double y = PI - x;
+   const double z = y*y - PI28;
+   const double z2 = z*z;
+   const double z4 = z2*z2;
+   const double p2 = P2[0] + z * P2[1] + z2 * (P2[2] + z * P2[3]) +
+      z4 * (P2[4] + z * P2[5]);
+   const double q2 = Q2[0] + z * Q2[1] + z2 * (Q2[2] + z * Q2[3]) +
+      z4 * (Q2[4] + z * Q2[5]);
+   const double p3 = P3[0] + z * P3[1] + z2 * (P3[2] + z * P3[3]) +
+      z4 * (P3[4] + z * P3[5]);
+   const double q3 = Q3[0] + z * Q3[1] + z2 * (Q3[2] + z * Q3[3]) +
+      z4 * (Q3[4] + z * Q3[5]);
+   const double p4 = P4[0] + z * P4[1] + z2 * (P4[2] + z * P4[3]) +
+      z4 * (P4[4] + z * P4[5]);
+   const double q4 = Q4[0] + z * Q4[1] + z2 * (Q4[2] + z * Q4[3]) +
+      z4 * (Q4[4] + z * Q4[5]);
+   const double p5 = P5[0] + z * P5[1] + z2 * (P5[2] + z * P5[3]) +
+      z4 * (P5[4] + z * P5[5]);
+   const double q5 = Q5[0] + z * Q5[1] + z2 * (Q5[2] + z * Q5[3]) +
+      z4 * (Q5[4] + z * Q5[5]);
+   const double p6 = P6[0] + z * P6[1] + z2 * (P6[2] + z * P6[3]) +
+      z4 * P6[4];
+   const double q6 = Q6[0] + z * Q6[1] + z2 * (Q6[2] + z * Q6[3]) +
+      z4 * (Q6[4] + z * Q6[5]);
+
+   // y*p/q vanishes for x == pi
+   return {{
+      cl1,
+      sgn*y*p2/q2,
+      p3/q3,
+      sgn*y*p4/q4,
+      p5/q5,
+      sgn*y*p6/q6
+   }};
+}
+
+} // namespace polylogarithm
@@ -0,0 +1,20 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <array>
+
+namespace polylogarithm {
+
+/// Clausen functions with n=1,...,6, element i contains Cl_{i+1}
+std::array<double, 6> Cl_all(double) noexcept;
+
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Cl_all.cpp"
+#endif
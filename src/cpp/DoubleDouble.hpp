@@ -0,0 +1,435 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include <cmath>
+#include <limits>
+
+namespace polylogarithm {
+
+/**
+ * Double-double number, represented as the unevaluated sum hi + lo of
+ * two doubles with |lo| <= ulp(hi)/2.  The arithmetic is built from
+ * error-free transformations of double operations and provides about
+ * 32 significant digits (106 bits).
+ *
+ * The algorithms require IEEE double arithmetic with round-to-nearest
+ * and without excess precision, i.e. they must not be compiled with
+ * -ffast-math or for the x87 FPU.  Non-finite values are not
+ * propagated reliably.
+ */
+struct DoubleDouble {
+   constexpr DoubleDouble(double hi_ = 0, double lo_ = 0) noexcept : hi(hi_), lo(lo_) {}
+   explicit constexpr operator double() const noexcept { return hi; }
+   double hi{}; ///< leading part
+   double lo{}; ///< trailing part
+};
+
+namespace detail {
+namespace dd {
+
+   /// 2^(-104), relative precision of a double-double number
+   constexpr double eps = 4.93038065763132e-32;
+
+   /// 1/n! for n = 0,...,30
+   constexpr DoubleDouble inv_fac[] = {
+      { 1.00000000000000000e+00,  0.00000000000000000e+00 },
+      { 1.00000000000000000e+00,  0.00000000000000000e+00 },
+      { 5.00000000000000000e-01,  0.00000000000000000e+00 },
+      { 1.66666666666666657e-01,  9.25185853854297066e-18 },
+      { 4.16666666666666644e-02,  2.31296463463574266e-18 },
+      { 8.33333333333333322e-03,  1.15648231731787138e-19 },
+      { 1.38888888888888894e-03, -5.30054395437357706e-20 },
+      { 1.98412698412698413e-04,  1.72095582934207053e-22 },
+      { 2.48015873015873016e-05,  2.15119478667758816e-23 },
+      { 2.75573192239858925e-06, -1.85839327404647208e-22 },
+      { 2.75573192239858883e-07,  2.37677146222502973e-23 },
+      { 2.50521083854417202e-08, -1.44881407093591197e-24 },
+      { 2.08767569878681002e-09, -1.20734505911325997e-25 },
+      { 1.60590438368216133e-10,  1.25852945887520981e-26 },
+      { 1.14707455977297245e-11,  2.06555127528307454e-28 },
+      { 7.64716373181981641e-13,  7.03872877733453001e-30 },
+      { 4.77947733238738525e-14,  4.39920548583408126e-31 },
+      { 2.81145725434552060e-15,  1.65088427308614326e-31 },
+      { 1.56192069685862253e-16,  1.19106796602737540e-32 },
+      { 8.22063524662432950e-18,  2.21418941196042654e-34 },
+      { 4.11031762331216484e-19,  1.44129733786595271e-36 },
+      { 1.95729410633912626e-20, -1.36435038300879085e-36 },
+      { 8.89679139245057408e-22, -7.91140261487237622e-38 },
+      { 3.86817017063068413e-23, -8.84317765548234385e-40 },
+      { 1.61173757109611839e-24, -3.68465735645097660e-41 },
+      { 6.44695028438447359e-26, -1.93304042337034648e-42 },
+      { 2.47959626322479759e-27, -1.29537309647652288e-43 },
+      { 9.18368986379554601e-29,  1.43031503967873220e-45 },
+      { 3.27988923706983776e-30,  1.51175427440298787e-46 },
+      { 1.13099628864477159e-31,  1.04980154129595060e-47 },
+      { 3.76998762881590539e-33,  2.58703478327503238e-49 }
+   };
+
+   constexpr DoubleDouble ln2  = { 6.93147180559945286e-01, 2.31904681384629956e-17 };
+   constexpr DoubleDouble pi   = { 3.14159265358979312e+00, 1.22464679914735321e-16 };
+   constexpr DoubleDouble pi2  = { 6.28318530717958623e+00, 2.44929359829470641e-16 };
+   constexpr DoubleDouble pi_2 = { 1.57079632679489656e+00, 6.12323399573676604e-17 };
+
+   /// returns s = fl(a + b) and err = a + b - s, requires |a| >= |b|
+   inline double quick_two_sum(double a, double b, double& err) noexcept
+   {
+      const double s = a + b;
+      err = b - (s - a);
+      return s;
+   }
+
+   /// returns s = fl(a + b) and err = a + b - s
+   inline double two_sum(double a, double b, double& err) noexcept
+   {
+      const double s = a + b;
+      const double bb = s - a;
+      err = (a - (s - bb)) + (b - bb);
+      return s;
+   }
+
+   /// returns p = fl(a*b) and err = a*b - p
+   inline double two_prod(double a, double b, double& err) noexcept
+   {
+      const double p = a*b;
+#ifdef FP_FAST_FMA
+      err = std::fma(a, b, -p);
+#else
+      // Dekker's splitting of a and b into 26 bit halves
+      const double split = 134217729.0; // 2^27 + 1
+      const double ta = split*a, tb = split*b;
+      const double ahi = ta - (ta - a), alo = a - ahi;
+      const double bhi = tb - (tb - b), blo = b - bhi;
+      err = ((ahi*bhi - p) + ahi*blo + alo*bhi) + alo*blo;
+#endif
+      return p;
+   }
+
+} // namespace dd
+} // namespace detail
+
+inline DoubleDouble operator-(const DoubleDouble& a) noexcept
+{
+   return { -a.hi, -a.lo };
+}
+
+inline DoubleDouble operator+(const DoubleDouble& a, const DoubleDouble& b) noexcept
+{
+   double e1, e2;
+   const double s1 = detail::dd::two_sum(a.hi, b.hi, e1);
+   const double s2 = detail::dd::two_sum(a.lo, b.lo, e2);
+   e1 += s2;
+   const double s3 = detail::dd::quick_two_sum(s1, e1, e1);
+   e1 += e2;
+   const double s4 = detail::dd::quick_two_sum(s3, e1, e1);
+   return { s4, e1 };
+}
+
+inline DoubleDouble operator+(const DoubleDouble& a, double b) noexcept
+{
+   double e;
+   const double s1 = detail::dd::two_sum(a.hi, b, e);
+   e += a.lo;
+   const double s2 = detail::dd::quick_two_sum(s1, e, e);
+   return { s2, e };
+}
+
+inline DoubleDouble operator+(double a, const DoubleDouble& b) noexcept
+{
+   return b + a;
+}
+
+inline DoubleDouble operator-(const DoubleDouble& a, const DoubleDouble& b) noexcept
+{
+   return a + (-b);
+}
+
+inline DoubleDouble operator-(const DoubleDouble& a, double b) noexcept
+{
+   return a + (-b);
+}
+
+inline DoubleDouble operator-(double a, const DoubleDouble& b) noexcept
+{
+   return (-b) + a;
+}
+
+inline DoubleDouble operator*(const DoubleDouble& a, const DoubleDouble& b) noexcept
+{
+   double e;
+   const double p1 = detail::dd::two_prod(a.hi, b.hi, e);
+   e += a.hi*b.lo + a.lo*b.hi;
+   const double p2 = detail::dd::quick_two_sum(p1, e, e);
+   return { p2, e };
+}
+
+inline DoubleDouble operator*(const DoubleDouble& a, double b) noexcept
+{
+   double e;
+   const double p1 = detail::dd::two_prod(a.hi, b, e);
+   e += a.lo*b;
+   const double p2 = detail::dd::quick_two_sum(p1, e, e);
+   return { p2, e };
+}
+
+inline DoubleDouble operator*(double a, const DoubleDouble& b) noexcept
+{
+   return b*a;
+}
+
+inline DoubleDouble operator/(const DoubleDouble& a, const DoubleDouble& b) noexcept
+{
+   if (b.hi == 0) {
+      return a.hi/b.hi;
+   }
+
+   // long division with three partial quotients
+   const double q1 = a.hi/b.hi;
+   DoubleDouble r = a - b*q1;
+   const double q2 = r.hi/b.hi;
+   r = r - b*q2;
+   const double q3 = r.hi/b.hi;
+
+   double e;
+   const double q = detail::dd::quick_two_sum(q1, q2, e);
+
+   return DoubleDouble(q, e) + q3;
+}
+
+inline DoubleDouble operator/(const DoubleDouble& a, double b) noexcept
+{
+   return a/DoubleDouble(b);
+}
+
+inline DoubleDouble operator/(double a, const DoubleDouble& b) noexcept
+{
+   return DoubleDouble(a)/b;
+}
+
+inline DoubleDouble& operator+=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a + b; }
+inline DoubleDouble& operator-=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a - b; }
+inline DoubleDouble& operator*=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a*b; }
+inline DoubleDouble& operator/=(DoubleDouble& a, const DoubleDouble& b) noexcept { return a = a/b; }
+
+constexpr bool operator==(const DoubleDouble& a, const DoubleDouble& b) noexcept { return a.hi == b.hi && a.lo == b.lo; }
+constexpr bool operator!=(const DoubleDouble& a, const DoubleDouble& b) noexcept { return !(a == b); }
+constexpr bool operator<(const DoubleDouble& a, const DoubleDouble& b) noexcept { return a.hi < b.hi || (a.hi == b.hi && a.lo < b.lo); }
+constexpr bool operator>(const DoubleDouble& a, const DoubleDouble& b) noexcept { return b < a; }
+constexpr bool operator<=(const DoubleDouble& a, const DoubleDouble& b) noexcept { return !(b < a); }
+constexpr bool operator>=(const DoubleDouble& a, const DoubleDouble& b) noexcept { return !(a < b); }
+
+constexpr bool operator==(const DoubleDouble& a, double b) noexcept { return a.hi == b && a.lo == 0; }
+constexpr bool operator!=(const DoubleDouble& a, double b) noexcept { return !(a == b); }
+constexpr bool operator<(const DoubleDouble& a, double b) noexcept { return a.hi < b || (a.hi == b && a.lo < 0); }
+constexpr bool operator>(const DoubleDouble& a, double b) noexcept { return a.hi > b || (a.hi == b && a.lo > 0); }
+constexpr bool operator<=(const DoubleDouble& a, double b) noexcept { return !(a > b); }
+constexpr bool operator>=(const DoubleDouble& a, double b) noexcept { return !(a < b); }
+
+inline DoubleDouble abs(const DoubleDouble& a) noexcept
+{
+   return a.hi < 0 ? -a : a;
+}
+
+inline DoubleDouble fabs(const DoubleDouble& a) noexcept
+{
+   return abs(a);
+}
+
+/// returns a*2^e
+inline DoubleDouble ldexp(const DoubleDouble& a, int e) noexcept
+{
+   return { std::ldexp(a.hi, e), std::ldexp(a.lo, e) };
+}
+
+inline bool isnan(const DoubleDouble& a) noexcept
+{
+   return std::isnan(a.hi);
+}
+
+inline DoubleDouble sqrt(const DoubleDouble& a) noexcept
+{
+   if (a.hi <= 0) {
+      return a.hi == 0 ? DoubleDouble() : DoubleDouble(std::numeric_limits<double>::quiet_NaN());
+   }
+
+   // one Newton step starting from the double precision result
+   const double x = 1/std::sqrt(a.hi);
+   const double ax = a.hi*x;
+   const double d = (a - DoubleDouble(ax)*ax).hi*(0.5*x);
+   double e;
+   const double s = detail::dd::two_sum(ax, d, e);
+
+   return { s, e };
+}
+
+/// returns sqrt(a^2 + b^2) without intermediate overflow
+inline DoubleDouble hypot(const DoubleDouble& a, const DoubleDouble& b) noexcept
+{
+   const DoubleDouble aa = abs(a), ab = abs(b);
+   const DoubleDouble m = aa > ab ? aa : ab;
+
+   if (m.hi == 0 || std::isinf(m.hi)) {
+      return m.hi;
+   }
+
+   const int e = std::ilogb(m.hi);
+   const DoubleDouble sa = ldexp(aa, -e), sb = ldexp(ab, -e);
+
+   return ldexp(sqrt(sa*sa + sb*sb), e);
+}
+
+inline DoubleDouble exp(const DoubleDouble& a) noexcept
+{
+   if (a.hi <= -709) {
+      return 0.0;
+   }
+   if (a.hi >= 709) {
+      return std::numeric_limits<double>::infinity();
+   }
+   if (a == 0) {
+      return 1.0;
+   }
+
+   // a = m*log(2) + 2^9*r, exp(a) = 2^m*exp(r)^(2^9)
+   const double m = std::floor(a.hi/detail::dd::ln2.hi + 0.5);
+   const DoubleDouble r = ldexp(a - detail::dd::ln2*m, -9);
+
+   // s = exp(r) - 1
+   DoubleDouble p = r*r;
+   DoubleDouble s = r + ldexp(p, -1);
+   int k = 3;
+
+   do {
+      p *= r;
+      const DoubleDouble t = p*detail::dd::inv_fac[k];
+      s += t;
+      if (std::abs(t.hi) <= 1e-3*detail::dd::eps) {
+         break;
+      }
+   } while (++k < 12);
+
+   // (1 + s)^2 - 1 = 2*s + s^2
+   for (int i = 0; i < 9; ++i) {
+      s = ldexp(s, 1) + s*s;
+   }
+
+   return ldexp(s + 1.0, static_cast<int>(m));
+}
+
+inline DoubleDouble log(const DoubleDouble& a) noexcept
+{
+   if (a.hi <= 0) {
+      return a.hi == 0 ? -std::numeric_limits<double>::infinity()
+                       : std::numeric_limits<double>::quiet_NaN();
+   }
+   if (a == 1) {
+      return 0.0;
+   }
+   if (std::isinf(a.hi)) {
+      return a.hi;
+   }
+
+   // one Newton step x + a*exp(-x) - 1 for the root of exp(x) = a
+   const DoubleDouble x = std::log(a.hi);
+
+   return x + a*exp(-x) - 1.0;
+}
+
+/// returns log(1 + a), accurate for small |a|
+inline DoubleDouble log1p(const DoubleDouble& a) noexcept
+{
+   const DoubleDouble u = 1.0 + a;
+
+   if (u == 1) {
+      return a;
+   }
+
+   // the rounding error of 1 + a cancels in log(u)/(u - 1)
+   return log(u)*(a/(u - 1.0));
+}
+
+namespace detail {
+namespace dd {
+
+   /// sin(a) and cos(a) for |a| <= pi/4 from the Taylor series of sin(a)
+   inline void sincos_taylor(const DoubleDouble& a, DoubleDouble& s, DoubleDouble& c) noexcept
+   {
+      const DoubleDouble x = -(a*a);
+      DoubleDouble p = a;
+      s = a;
+
+      for (int k = 3; k < 30; k += 2) {
+         p *= x;
+         const DoubleDouble t = p*inv_fac[k];
+         s += t;
+         if (std::abs(t.hi) <= eps*1e-2) {
+            break;
+         }
+      }
+
+      // no cancellation, as cos(a) >= 1/sqrt(2)
+      c = sqrt(1.0 - s*s);
+   }
+
+} // namespace dd
+} // namespace detail
+
+/// computes s = sin(a) and c = cos(a)
+inline void sincos(const DoubleDouble& a, DoubleDouble& s, DoubleDouble& c) noexcept
+{
+   // reduction to r in [-pi, pi] and t in [-pi/4, pi/4]
+   const double z = std::round((a/detail::dd::pi2).hi);
+   const DoubleDouble r = a - detail::dd::pi2*z;
+   const int j = static_cast<int>(std::round(r.hi/detail::dd::pi_2.hi));
+   const DoubleDouble t = r - detail::dd::pi_2*static_cast<double>(j);
+
+   DoubleDouble st, ct;
+   detail::dd::sincos_taylor(t, st, ct);
+
+   switch (j) {
+   case 0:          s =  st; c =  ct; break;
+   case 1:          s =  ct; c = -st; break;
+   case -1:         s = -ct; c =  st; break;
+   default: /* ±2 */ s = -st; c = -ct; break;
+   }
+}
+
+inline DoubleDouble sin(const DoubleDouble& a) noexcept
+{
+   DoubleDouble s, c;
+   sincos(a, s, c);
+   return s;
+}
+
+inline DoubleDouble cos(const DoubleDouble& a) noexcept
+{
+   DoubleDouble s, c;
+   sincos(a, s, c);
+   return c;
+}
+
+inline DoubleDouble atan2(const DoubleDouble& y, const DoubleDouble& x) noexcept
+{
+   if (x == 0) {
+      return y == 0 ? DoubleDouble(std::atan2(y.hi, x.hi))
+                    : (y.hi > 0 ? detail::dd::pi_2 : -detail::dd::pi_2);
+   }
+   if (y == 0) {
+      return x.hi > 0 ? DoubleDouble(y.hi) : (std::signbit(y.hi) ? -detail::dd::pi : detail::dd::pi);
+   }
+
+   // correction of the double precision result z, using
+   // tan(atan2(y, x) - z) = (y*cos(z) - x*sin(z))/(x*cos(z) + y*sin(z))
+   DoubleDouble z = std::atan2(y.hi, x.hi);
+   DoubleDouble sz, cz;
+   sincos(z, sz, cz);
+
+   z += (y*cz - x*sz)/(x*cz + y*sz);
+
+   return z;
+}
+
+} // namespace polylogarithm
@@ -10,10 +10,14 @@
 #include "Li4.hpp"
 #include "Li5.hpp"
 #include "Li6.hpp"
+#include "LiPlan.hpp"
+#include "branch_counter.hpp"
 #include "eta.hpp"
 #include "factorial.hpp"
 #include "harmonic.hpp"
+#include "li_detail.hpp"
 #include "zeta.hpp"
+#include <algorithm>
 #include <cmath>
 #include <complex>
 #include <cstdint>
@@ -21,61 +25,93 @@
 
 namespace polylogarithm {
 
-namespace {
-   constexpr double inf = std::numeric_limits<double>::infinity();
-   constexpr double nan = std::numeric_limits<double>::quiet_NaN();
-   constexpr double PI = 3.1415926535897932;
+namespace detail {
+namespace li {
+   /// returns x^n for n >= 0 as m*2^e, such that neither m nor the
+   /// intermediate products overflow
+   POLYLOGARITHM_INLINE double pow_int_scaled(double x, int64_t n, int64_t& e) noexcept
+   {
+      int ex = 0, er = 0;
+      double result = 1;
+      x = std::frexp(x, &ex);
+      e = 0;
 
-   constexpr bool is_even(int64_t n) noexcept { return n % 2 == 0; }
+      while (n > 0) {
+         if (n & 1) {
+            result = std::frexp(result*x, &er);
+            e += er + ex;
+         }
+         x = std::frexp(x*x, &er);
+         ex = 2*ex + er;
+         n >>= 1;
+      }
 
-   constexpr bool is_finite(const std::complex<double>& z) noexcept
-   {
-      return std::isfinite(std::real(z)) && std::isfinite(std::imag(z));
+      return result;
    }
 
-   /// complex logarithm, converts -0.0 to 0.0
-   std::complex<double> clog(const std::complex<double>& z) noexcept
+   /// returns z*2^e, where e is clamped to the range of int
+   POLYLOGARITHM_INLINE std::complex<double> ldexp(const std::complex<double>& z, int64_t e) noexcept
    {
-      const double n = std::hypot(std::real(z), std::imag(z));
-      double a = std::arg(z);
-
-      if (std::imag(z) == 0.0 && a < 0.0) {
-         a = -a;
-      }
-
-      return { std::log(n), a };
+      const int64_t emax = std::numeric_limits<int>::max();
+      const int ei = static_cast<int>(e < -emax ? -emax : (e > emax ? emax : e));
+      return { std::ldexp(std::real(z), ei), std::ldexp(std::imag(z), ei) };
    }
 
    /// Series expansion of Li_n(z) in terms of powers of z.
    /// Fast convergence for large n >= 12.
-   std::complex<double> Li_series(int64_t n, const std::complex<double>& z) noexcept
+   /// The weights k^(-n) are computed by binary exponentiation
+   /// instead of std::pow.
+   POLYLOGARITHM_INLINE std::complex<double> Li_series(int64_t n, const std::complex<double>& z) noexcept
    {
-      std::complex<double> sum(0.0, 0.0), sum_old(0.0, 0.0), p = z;
-      int64_t k = 0;
+      std::complex<double> sum = z, sum_old(0.0, 0.0), zk = z;
+      int64_t k = 1;
+
+      if (n < 0) {
+         // The weights k^|n| overflow long before the terms
+         // z^k*k^|n| do, and z^k may underflow.  Therefore z^k =
+         // zk*2^ez and k^|n| are kept normalized and are scaled back
+         // only after they have been multiplied.
+         int64_t ez = 0;
+
+         do {
+            k++;
+            int ek = 0;
+            zk *= z;
+            const double a = std::max(std::abs(std::real(zk)), std::abs(std::imag(zk)));
+            std::frexp(a, &ek);
+            zk = ldexp(zk, -ek);
+            ez += ek;
+            int64_t ew = 0;
+            const double w = pow_int_scaled(static_cast<double>(k), -n, ew); // k^|n|
+            const std::complex<double> term = ldexp(zk*w, ez + ew);
+            if (!is_finite(term)) { break; }
+            sum_old = sum;
+            sum += term;
+         } while (sum != sum_old &&
+                  k < std::numeric_limits<int64_t>::max() - 2);
+
+         return sum;
+      }
 
       do {
          k++;
+         zk *= z;
+         const double w = pow_int(static_cast<double>(k), n); // k^n
+         const std::complex<double> term = zk/w;
+         if (!is_finite(term)) { break; }
          sum_old = sum;
-         sum += p;
-         p *= z*std::pow(k/(1.0 + k), n);
-         if (!is_finite(p)) { break; }
+         sum += term;
       } while (sum != sum_old &&
                k < std::numeric_limits<int64_t>::max() - 2);
 
       return sum;
    }
 
-   /// Series expansion of Li_n(z) around z ~ 1, n > 0
-   std::complex<double> Li_unity_pos(int64_t n, const std::complex<double>& z) noexcept
+   POLYLOGARITHM_INLINE std::complex<double> Li_unity_pos_tail(
+      int64_t n, const std::complex<double>& lnz, std::complex<double> p,
+      std::complex<double> sum) noexcept
    {
-      const std::complex<double> lnz = clog(z);
       const std::complex<double> lnz2 = lnz*lnz;
-      std::complex<double> sum(zeta(n), 0.0), p(1.0, 0.0);
-
-      for (int64_t j = 1; j < n - 1; ++j) {
-         p *= lnz/static_cast<double>(j);
-         sum += zeta(n - j)*p;
-      }
 
       p *= lnz/static_cast<double>(n - 1);
       sum += (harmonic(n - 1) - clog(-lnz))*p;
@@ -96,8 +132,22 @@ namespace {
       return sum;
    }
 
+   /// Series expansion of Li_n(z) around z ~ 1, n > 0
+   POLYLOGARITHM_INLINE std::complex<double> Li_unity_pos(int64_t n, const std::complex<double>& z) noexcept
+   {
+      const std::complex<double> lnz = clog(z);
+      std::complex<double> sum(zeta(n), 0.0), p(1.0, 0.0);
+
+      for (int64_t j = 1; j < n - 1; ++j) {
+         p *= lnz/static_cast<double>(j);
+         sum += zeta(n - j)*p;
+      }
+
+      return Li_unity_pos_tail(n, lnz, p, sum);
+   }
+
    /// returns z^n, treating Re(z) == 0 and Im(z) == 0 in a stable way
-   std::complex<double> stable_pow(const std::complex<double>& z, int64_t n) noexcept
+   POLYLOGARITHM_INLINE std::complex<double> stable_pow(const std::complex<double>& z, int64_t n) noexcept
    {
       if (std::imag(z) == 0) {
          return { std::pow(std::real(z), n), 0.0 };
@@ -116,7 +166,7 @@ namespace {
    }
 
    /// Series expansion of Li_n(z) around z ~ 1, n < 0
-   std::complex<double> Li_unity_neg(int64_t n, const std::complex<double>& z) noexcept
+   POLYLOGARITHM_INLINE std::complex<double> Li_unity_neg(int64_t n, const std::complex<double>& z) noexcept
    {
       const std::complex<double> lnz = clog(z);
       const std::complex<double> lnz2 = lnz*lnz;
@@ -145,8 +195,20 @@ namespace {
       return sum;
    }
 
+   /// Li_n(z) for n < -1 and |z| < 1, where either the series in
+   /// powers of z or the expansion around z ~ 1 converges
+   POLYLOGARITHM_INLINE std::complex<double> Li_neg(int64_t n, const std::complex<double>& z) noexcept
+   {
+      const double nz = std::norm(z);
+      const double nl = std::norm(clog(z));
+      if (4*PI*PI*nz < nl) {
+         return Li_series(n, z);
+      }
+      return Li_unity_neg(n, z);
+   }
+
    /// returns remainder from inversion formula
-   std::complex<double> Li_rest(int64_t n, const std::complex<double>& z) noexcept
+   POLYLOGARITHM_INLINE std::complex<double> Li_rest(int64_t n, const std::complex<double>& z) noexcept
    {
       const std::complex<double> lnz = clog(-z);
       const std::complex<double> lnz2 = lnz*lnz;
@@ -165,7 +227,8 @@ namespace {
       return 2.0*sum - p*inv_fac(n);
    }
 
-} // anonymous namespace
+} // namespace li
+} // namespace detail
 
 /**
  * @brief Complex polylogarithm \f$\operatorname{Li}_n(z)\f$
@@ -176,57 +239,98 @@ namespace {
  *
  * For n < 0 the implementation follows the approach presented in
  * [Matthew Roughan: "The Polylogarithm Function in Julia",
- * arXiv:2010.09860].
+ * arXiv:2010.09860].  Outside the convergence regions of both
+ * series, which implies \f$|z| > 1\f$, the inversion relation
+ * \f$\operatorname{Li}_n(z) = -(-1)^n \operatorname{Li}_n(1/z)\f$
+ * is used instead of the duplication formula, so that each call
+ * evaluates exactly one series.
  */
-std::complex<double> Li(int64_t n, const std::complex<double>& z) noexcept
+POLYLOGARITHM_INLINE std::complex<double> Li(int64_t n, const std::complex<double>& z) noexcept
 {
    if (std::isnan(std::real(z)) || std::isnan(std::imag(z))) {
-      return {nan, nan};
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
+      return {detail::li::nan, detail::li::nan};
    } else if (std::isinf(std::real(z)) || std::isinf(std::imag(z))) {
-      return {-inf, 0.0};
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
+      return {-detail::li::inf, 0.0};
    } else if (z == 0.0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
       return {0.0, 0.0};
    } else if (z == 1.0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
       if (n <= 0) {
-         return {inf, inf};
+         return {detail::li::inf, detail::li::inf};
       }
       return {zeta(n), 0.0};
    } else if (z == -1.0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
       return {neg_eta(n), 0.0};
    } else if (n < -1) {
       // arXiv:2010.09860
       const double nz = std::norm(z);
-      const double nl = std::norm(clog(z));
-      if (4*PI*PI*nz < nl) {
-         return Li_series(n, z);
-      } else if (nl < 0.512*0.512*4*PI*PI) {
-         return Li_unity_neg(n, z);
+      const double nl = std::norm(detail::li::clog(z));
+      if (4*detail::li::PI*detail::li::PI*nz < nl) {
+         POLYLOGARITHM_COUNT_BRANCH(Li_neg_series);
+         return detail::li::Li_series(n, z);
+      } else if (nl < 0.512*0.512*4*detail::li::PI*detail::li::PI) {
+         POLYLOGARITHM_COUNT_BRANCH(Li_neg_unity);
+         return detail::li::Li_unity_neg(n, z);
       }
-      const auto sqrtz = std::sqrt(z);
-      return std::exp2(n - 1)*(Li(n, sqrtz) + Li(n, -sqrtz));
+      POLYLOGARITHM_COUNT_BRANCH(Li_neg_inversion);
+      // here |z| > 1, use Li_n(z) = -(-1)^n Li_n(1/z) for n < 0
+      const double sgn = detail::li::is_even(n) ? -1.0 : 1.0;
+      return sgn*detail::li::Li_neg(n, 1.0/z);
    } else if (n == -1) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_closed_form);
       return z/((1.0 - z)*(1.0 - z));
    } else if (n == 0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_closed_form);
       return z/(1.0 - z);
    } else if (n == 1) {
-      return -clog(1.0 - z);
+      POLYLOGARITHM_COUNT_BRANCH(Li_closed_form);
+      return -detail::li::clog(1.0 - z);
    } else if (n == 2) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_dedicated);
       return Li2(z);
    } else if (n == 3) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_dedicated);
       return Li3(z);
    } else if (n == 4) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_dedicated);
       return Li4(z);
    } else if (n == 5) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_dedicated);
       return Li5(z);
    } else if (n == 6) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_dedicated);
       return Li6(z);
    } else if (std::norm(z) <= 0.75*0.75) {
-      return Li_series(n, z);
+      POLYLOGARITHM_COUNT_BRANCH(Li_series);
+      return detail::li::Li_series(n, z);
    } else if (std::norm(z) >= 1.4*1.4) {
-      const double sgn = is_even(n) ? -1.0 : 1.0;
-      return sgn*Li_series(n, 1.0/z) + Li_rest(n, z);
+      POLYLOGARITHM_COUNT_BRANCH(Li_inversion);
+      const double sgn = detail::li::is_even(n) ? -1.0 : 1.0;
+      return sgn*detail::li::Li_series(n, 1.0/z) + detail::li::Li_rest(n, z);
    }
-   return Li_unity_pos(n, z);
+   POLYLOGARITHM_COUNT_BRANCH(Li_unity_pos);
+   return detail::li::Li_unity_pos(n, z);
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_n(z)\f$ for an array
+ * @param n degree of the polylogarithm
+ * @param z array of complex arguments
+ * @param out array of size count, filled with \f$\operatorname{Li}_n(z)\f$
+ * @param count number of elements
+ * @author Alexander Voigt
+ *
+ * The weights of the series expansions are computed once for all
+ * elements, see LiPlan.
+ */
+POLYLOGARITHM_INLINE void Li(int64_t n, const std::complex<double>* z, std::complex<double>* out, std::size_t count)
+{
+   const LiPlan plan(n);
+   plan(z, out, count);
 }
 
 } // namespace polylogarithm
@@ -5,12 +5,116 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
+#include "Li2.hpp"
+#include "Li3.hpp"
+#include "Li4.hpp"
+#include "Li5.hpp"
+#include "Li6.hpp"
+#include "branch_counter.hpp"
+#include "li_detail.hpp"
 #include <complex>
+#include <cstddef>
 #include <cstdint>
+#include <type_traits>
 
 namespace polylogarithm {
 
 /// complex polylogarithm for arbitrary integer n
 std::complex<double> Li(int64_t n, const std::complex<double>&) noexcept;
 
+/// complex polylogarithm for arbitrary integer n for an array of complex numbers
+void Li(int64_t n, const std::complex<double>* z, std::complex<double>* out, std::size_t count);
+
+namespace detail {
+namespace li {
+
+/// Li(N, z) for 6 < N <= N_UNROLL with fixed-length sums
+template <int64_t N>
+std::complex<double> Li_fixed(const std::complex<double>& z, std::true_type) noexcept
+{
+   if (std::isnan(std::real(z)) || std::isnan(std::imag(z))) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
+      return {nan, nan};
+   } else if (std::isinf(std::real(z)) || std::isinf(std::imag(z))) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
+      return {-inf, 0.0};
+   } else if (z == 0.0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
+      return {0.0, 0.0};
+   } else if (z == 1.0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
+      return {zeta(N), 0.0};
+   } else if (z == -1.0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_special);
+      return {neg_eta(N), 0.0};
+   } else if (std::norm(z) <= 0.75*0.75) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_series);
+      return Li_series(N, z);
+   } else if (std::norm(z) >= 1.4*1.4) {
+      POLYLOGARITHM_COUNT_BRANCH(Li_inversion);
+      const double sgn = is_even(N) ? -1.0 : 1.0;
+      return sgn*Li_series(N, 1.0/z) + Li_rest<N>(z);
+   }
+   POLYLOGARITHM_COUNT_BRANCH(Li_unity_pos);
+   return Li_unity_pos<N>(z);
+}
+
+/// Li(N, z) for all other orders
+template <int64_t N>
+std::complex<double> Li_fixed(const std::complex<double>& z, std::false_type) noexcept
+{
+   return polylogarithm::Li(N, z);
+}
+
+} // namespace li
+} // namespace detail
+
+/**
+ * Complex polylogarithm for integer n known at compile time.  For
+ * 6 < N <= 64 the coefficients of the remainder of the inversion
+ * formula and of the leading N - 2 terms of the series around z ~ 1
+ * are compile-time constants and the sums are unrolled.
+ */
+template <int64_t N>
+std::complex<double> Li(const std::complex<double>& z) noexcept
+{
+   return detail::li::Li_fixed<N>(
+      z, std::integral_constant<bool, (N > 6 && N <= detail::li::N_UNROLL)>());
+}
+
+template <>
+inline std::complex<double> Li<2>(const std::complex<double>& z) noexcept
+{
+   return Li2(z);
+}
+
+template <>
+inline std::complex<double> Li<3>(const std::complex<double>& z) noexcept
+{
+   return Li3(z);
+}
+
+template <>
+inline std::complex<double> Li<4>(const std::complex<double>& z) noexcept
+{
+   return Li4(z);
+}
+
+template <>
+inline std::complex<double> Li<5>(const std::complex<double>& z) noexcept
+{
+   return Li5(z);
+}
+
+template <>
+inline std::complex<double> Li<6>(const std::complex<double>& z) noexcept
+{
+   return Li6(z);
+}
+
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li.cpp"
+#endif
@@ -5,14 +5,19 @@
 // ====================================================================
 
 #include "Li2.hpp"
+#include "branch_counter.hpp"
 #include "complex.hpp"
+#include "li_coeffs.hpp"
+#include "li_kernel.hpp"
 #include <cfloat>
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace polylogarithm {
 
-namespace {
+namespace detail {
+namespace li2 {
 
    template <typename T, int N>
    T horner(T x, const T (&c)[N]) noexcept
@@ -24,25 +29,123 @@ namespace {
       return p;
    }
 
-   template <int Nstart, typename T, int N>
-   Complex<T> horner(const Complex<T>& z, const T (&coeffs)[N]) noexcept
+   /// rational function approximation of Li2(y) for y in [0, 1/2]
+   inline double li2_approx(double y) noexcept
    {
-      static_assert(0 <= Nstart && Nstart < N && N >= 2, "invalid array bounds");
+      const double P[] = {
+         0.9999999999999999502e+0,
+        -2.6883926818565423430e+0,
+         2.6477222699473109692e+0,
+        -1.1538559607887416355e+0,
+         2.0886077795020607837e-1,
+        -1.0859777134152463084e-2
+      };
+      const double Q[] = {
+         1.0000000000000000000e+0,
+        -2.9383926818565635485e+0,
+         3.2712093293018635389e+0,
+        -1.7076702173954289421e+0,
+         4.1596017228400603836e-1,
+        -3.9801343754084482956e-2,
+         8.2743668974466659035e-4
+      };
+
+      const double y2 = y*y;
+      const double y4 = y2*y2;
+      const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]) +
+                       y4 * (P[4] + y * P[5]);
+      const double q = Q[0] + y * Q[1] + y2 * (Q[2] + y * Q[3]) +
+                       y4 * (Q[4] + y * Q[5] + y2 * Q[6]);
+
+      return y*p/q;
+   }
 
-      const T r = z.re + z.re;
-      const T s = z.re * z.re + z.im * z.im;
-      T a = coeffs[N - 1], b = coeffs[N - 2];
+   /// rational function approximation of Li2(y) for y in [0, 1/2]
+   /// with a maximum relative error of 2e-11
+   inline double li2_approx_fast(double y) noexcept
+   {
+      const double P[] = {
+         9.9999999998025968e-01,
+        -1.5096740171083725e+00,
+         6.1010609313936537e-01,
+        -4.3170521848714012e-02,
+        -1.8849786294980813e-03
+      };
+      const double Q[] = {
+         1.0000000000000000e+00,
+        -1.7596740209448816e+00,
+         9.3891361173588406e-01,
+        -1.4488111416233052e-01
+      };
+
+      const double y2 = y*y;
+      const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3] + y2 * P[4]);
+      const double q = Q[0] + y * Q[1] + y2 * (Q[2] + y * Q[3]);
+
+      return y*p/q;
+   }
 
-      for (int i = N - 3; i >= Nstart; --i) {
-         const T t = a;
-         a = b + r * a;
-         b = coeffs[i] - s * t;
+   /// Li2(x) for real x, using the transformations of
+   /// [arXiv:2201.01678] to [0, 1/2], where approx(y) approximates
+   /// Li2(y) for y in [0, 1/2]
+   template <double (*approx)(double)>
+   double li2_real(double x) noexcept
+   {
+      const double PI = 3.1415926535897932;
+
+      double y = 0, r = 0, s = 1;
+
+      // transform to [0, 1/2]
+      if (x < -1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_lt_m1);
+         const double l = std::log(1 - x);
+         y = 1/(1 - x);
+         r = -PI*PI/6 + l*(0.5*l - std::log(-x));
+         s = 1;
+      } else if (x == -1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_eq_m1);
+         return -PI*PI/12;
+      } else if (x < 0) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_lt_0);
+         const double l = std::log1p(-x);
+         y = x/(x - 1);
+         r = -0.5*l*l;
+         s = -1;
+      } else if (x == 0) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_eq_0);
+         return 0;
+      } else if (x < 0.5) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_lt_half);
+         y = x;
+         r = 0;
+         s = 1;
+      } else if (x < 1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_lt_1);
+         y = 1 - x;
+         r = PI*PI/6 - std::log(x)*std::log1p(-x);
+         s = -1;
+      } else if (x == 1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_eq_1);
+         return PI*PI/6;
+      } else if (x < 2) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_lt_2);
+         const double l = std::log(x);
+         y = 1 - 1/x;
+         r = PI*PI/6 - l*(std::log(y) + 0.5*l);
+         s = 1;
+      } else {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_x_ge_2);
+         const double l = std::log(x);
+         y = 1/x;
+         r = PI*PI/3 - 0.5*l*l;
+         s = -1;
       }
 
-      return Complex<T>(z.re*a + b, z.im*a);
+      return r + s*approx(y);
    }
 
-} // anonymous namespace
+} // namespace li2
+} // namespace detail
 
 /**
  * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$
@@ -53,7 +156,7 @@ namespace {
  * Implemented as a rational function approximation with a maximum
  * error of 2e-7.
  */
-float Li2(float x) noexcept
+POLYLOGARITHM_INLINE float Li2(float x) noexcept
 {
    const float PI = 3.14159265f;
    const float P[] = { 1.00000020f, -0.780790946f, 0.0648256871f };
@@ -115,74 +218,54 @@ float Li2(float x) noexcept
  * error of 5e-17
  * [[arXiv:2201.01678](https://arxiv.org/abs/2201.01678)].
  */
-double Li2(double x) noexcept
+POLYLOGARITHM_INLINE double Li2(double x) noexcept
 {
-   const double PI = 3.1415926535897932;
-   const double P[] = {
-      0.9999999999999999502e+0,
-     -2.6883926818565423430e+0,
-      2.6477222699473109692e+0,
-     -1.1538559607887416355e+0,
-      2.0886077795020607837e-1,
-     -1.0859777134152463084e-2
-   };
-   const double Q[] = {
-      1.0000000000000000000e+0,
-     -2.9383926818565635485e+0,
-      3.2712093293018635389e+0,
-     -1.7076702173954289421e+0,
-      4.1596017228400603836e-1,
-     -3.9801343754084482956e-2,
-      8.2743668974466659035e-4
-   };
+   return detail::li2::li2_real<detail::li2::li2_approx>(x);
+}
 
-   double y = 0, r = 0, s = 1;
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ with reduced accuracy
+ * @param x real argument
+ * @return \f$\operatorname{Li}_2(x)\f$
+ * @author Alexander Voigt
+ *
+ * Same transformations as Li2(double), but with a lower-degree
+ * rational function approximation with a maximum error of
+ * approximately 2e-11 (relative, or absolute where |Li2(x)| < 1).
+ * Intended for applications, which do not need
+ * full double precision, such as Monte Carlo grid adaptation.
+ * The branches are counted like those of Li2(double).
+ */
+POLYLOGARITHM_INLINE double Li2_fast(double x) noexcept
+{
+   return detail::li2::li2_real<detail::li2::li2_approx_fast>(x);
+}
 
-   // transform to [0, 1/2]
-   if (x < -1) {
-      const double l = std::log(1 - x);
-      y = 1/(1 - x);
-      r = -PI*PI/6 + l*(0.5*l - std::log(-x));
-      s = 1;
-   } else if (x == -1) {
-      return -PI*PI/12;
-   } else if (x < 0) {
-      const double l = std::log1p(-x);
-      y = x/(x - 1);
-      r = -0.5*l*l;
-      s = -1;
-   } else if (x == 0) {
-      return 0;
-   } else if (x < 0.5) {
-      y = x;
-      r = 0;
-      s = 1;
-   } else if (x < 1) {
-      y = 1 - x;
-      r = PI*PI/6 - std::log(x)*std::log1p(-x);
-      s = -1;
-   } else if (x == 1) {
-      return PI*PI/6;
-   } else if (x < 2) {
-      const double l = std::log(x);
-      y = 1 - 1/x;
-      r = PI*PI/6 - l*(std::log(y) + 0.5*l);
-      s = 1;
-   } else {
-      const double l = std::log(x);
-      y = 1/x;
-      r = PI*PI/3 - 0.5*l*l;
-      s = -1;
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ for an array
+ * @param x array of real arguments
+ * @param out array of size n, filled with \f$\operatorname{Li}_2(x)\f$
+ * @param n number of elements
+ * @author Alexander Voigt
+ */
+POLYLOGARITHM_INLINE void Li2(const double* x, double* out, std::size_t n) noexcept
+{
+   for (std::size_t i = 0; i < n; ++i) {
+      out[i] = Li2(x[i]);
    }
+}
 
-   const double y2 = y*y;
-   const double y4 = y2*y2;
-   const double p = P[0] + y * P[1] + y2 * (P[2] + y * P[3]) +
-                    y4 * (P[4] + y * P[5]);
-   const double q = Q[0] + y * Q[1] + y2 * (Q[2] + y * Q[3]) +
-                    y4 * (Q[4] + y * Q[5] + y2 * Q[6]);
-
-   return r + s*y*p/q;
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ for a vector
+ * @param x vector of real arguments
+ * @return vector of \f$\operatorname{Li}_2(x)\f$
+ * @author Alexander Voigt
+ */
+POLYLOGARITHM_INLINE std::vector<double> Li2(const std::vector<double>& x)
+{
+   std::vector<double> out(x.size());
+   Li2(x.data(), out.data(), x.size());
+   return out;
 }
 
 /**
@@ -195,7 +278,7 @@ double Li2(double x) noexcept
  * error of 2.13e-20 (long double precision) and 1.03e-38 (quadruple
  * precision), respectively.
  */
-long double Li2(long double x) noexcept
+POLYLOGARITHM_INLINE long double Li2(long double x) noexcept
 {
    const long double PI  = 3.14159265358979323846264338327950288L;
 
@@ -304,8 +387,8 @@ long double Li2(long double x) noexcept
 
    const long double z = y - 0.25L;
 
-   const long double p = horner(z, P);
-   const long double q = horner(z, Q);
+   const long double p = detail::li2::horner(z, P);
+   const long double q = detail::li2::horner(z, Q);
 
    return r + s*y*p/q;
 }
@@ -318,7 +401,7 @@ long double Li2(long double x) noexcept
  * @author Werner Porod
  * @note translated to C++ by Alexander Voigt
  */
-std::complex<float> Li2(const std::complex<float>& z_) noexcept
+POLYLOGARITHM_INLINE std::complex<float> Li2(const std::complex<float>& z_) noexcept
 {
    const float PI = 3.14159265f;
    const Complex<float> z = { std::real(z_), std::imag(z_) };
@@ -376,7 +459,7 @@ std::complex<float> Li2(const std::complex<float>& z_) noexcept
 
    const Complex<float> u2(u*u);
 
-   return sgn*(u + u2*(bf[0] + u*horner<1>(u2, bf))) + rest;
+   return sgn*(u + u2*(bf[0] + u*detail::li_coeffs::horner<1>(u2, bf))) + rest;
 }
 
 /**
@@ -387,28 +470,16 @@ std::complex<float> Li2(const std::complex<float>& z_) noexcept
  * @author Werner Porod
  * @note translated to C++ by Alexander Voigt
  */
-std::complex<double> Li2(const std::complex<double>& z_) noexcept
+POLYLOGARITHM_INLINE std::complex<double> Li2(const std::complex<double>& z_) noexcept
 {
    const double PI = 3.1415926535897932;
    const Complex<double> z = { std::real(z_), std::imag(z_) };
 
-   // bf[1..N-1] are the even Bernoulli numbers / (2 n + 1)!
-   // generated by: Table[BernoulliB[2 n]/(2 n + 1)!, {n, 1, 9}]
-   const double bf[10] = {
-      - 1.0/4.0,
-      + 1.0/36.0,
-      - 1.0/3600.0,
-      + 1.0/211680.0,
-      - 1.0/10886400.0,
-      + 1.0/526901760.0,
-      - 4.0647616451442255e-11,
-      + 8.9216910204564526e-13,
-      - 1.9939295860721076e-14,
-      + 4.5189800296199182e-16
-   };
+   const auto& bf = detail::li_coeffs::Tables<>::li2_bf;
 
    // special cases
    if (z.im == 0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li2_z_real);
       if (z.re <= 1) {
          return Li2(z.re);
       }
@@ -419,6 +490,7 @@ std::complex<double> Li2(const std::complex<double>& z_) noexcept
    const double nz = norm_sqr(z);
 
    if (nz < std::numeric_limits<double>::epsilon()) {
+      POLYLOGARITHM_COUNT_BRANCH(Li2_z_small);
       return z*(1.0 + 0.25*z);
    }
 
@@ -428,21 +500,25 @@ std::complex<double> Li2(const std::complex<double>& z_) noexcept
    // transformation to |z|<1, Re(z)<=0.5
    if (z.re <= 0.5) {
       if (nz > 1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_z_re_le_half_abs_gt_1);
          const Complex<double> lz = log(-z);
          u = -log(1.0 - 1.0 / z);
          rest = -0.5*lz*lz - PI*PI/6;
          sgn = -1;
       } else { // nz <= 1
+         POLYLOGARITHM_COUNT_BRANCH(Li2_z_re_le_half_abs_le_1);
          u = -log(1.0 - z);
          rest = 0;
          sgn = 1;
       }
    } else { // z.re > 0.5
       if (nz <= 2*z.re) {
+         POLYLOGARITHM_COUNT_BRANCH(Li2_z_re_gt_half_near_1);
          u = -log(z);
          rest = u*log(1.0 - z) + PI*PI/6;
          sgn = -1;
       } else { // nz > 2*z.re
+         POLYLOGARITHM_COUNT_BRANCH(Li2_z_re_gt_half_far_1);
          const Complex<double> lz = log(-z);
          u = -log(1.0 - 1.0 / z);
          rest = -0.5*lz*lz - PI*PI/6;
@@ -452,7 +528,69 @@ std::complex<double> Li2(const std::complex<double>& z_) noexcept
 
    const Complex<double> u2(u*u);
 
-   return sgn*(u + u2*(bf[0] + u*horner<1>(u2, bf))) + rest;
+   return sgn*(u + u2*(bf[0] + u*detail::li_coeffs::horner<1, 10>(u2, bf))) + rest;
+}
+
+/**
+ * @brief Complex dilogarithm \f$\operatorname{Li}_2(z)\f$ for arrays
+ * @param re array of real parts of the arguments
+ * @param im array of imaginary parts of the arguments
+ * @param out_re array of size n, filled with \f$\operatorname{Re}[\operatorname{Li}_2(z)]\f$
+ * @param out_im array of size n, filled with \f$\operatorname{Im}[\operatorname{Li}_2(z)]\f$
+ * @param n number of elements
+ * @author Alexander Voigt
+ *
+ * Uses the same Bernoulli series as Li2(const std::complex<double>&)
+ * for arguments stored as separate arrays of real and imaginary parts.
+ * The transformation to |z|<1, Re(z)<=0.5 is selected by conditional
+ * expressions instead of branches.  Real arguments are evaluated with
+ * the real dilogarithm afterwards.
+ */
+POLYLOGARITHM_INLINE void Li2(const double* re, const double* im, double* out_re, double* out_im, std::size_t n) noexcept
+{
+   const double PI = 3.1415926535897932;
+
+   const auto& bf = detail::li_coeffs::Tables<>::li2_bf;
+
+   for (std::size_t i = 0; i < n; ++i) {
+      const Complex<double> z(re[i], im[i]);
+      const double nz = norm_sqr(z);
+
+      // transformation to |z|<1, Re(z)<=0.5:
+      // inv: u = -log(1 - 1/z), rest = -log(-z)^2/2 - pi^2/6, sgn = -1
+      // ref: u = -log(z)      , rest = u*log(1 - z) + pi^2/6, sgn = -1
+      // otherwise: u = -log(1 - z), rest = 0, sgn = 1
+      const bool inv = z.re <= 0.5 ? nz > 1 : nz > 2*z.re;
+      const bool ref = !inv && z.re > 0.5;
+      const double one_re = inv ? 1 - z.re/nz : 1 - z.re;
+      const double one_im = inv ? z.im/nz : -z.im;
+      const Complex<double> w(ref ? z.re : one_re, ref ? z.im : one_im);
+      const Complex<double> v(inv ? -z.re : ref ? 1 - z.re : 1.0, inv ? -z.im : ref ? -z.im : 0.0);
+      const Complex<double> u = -log(w);
+      const Complex<double> lv = log(v);
+      const Complex<double> rest_inv = -0.5*lv*lv - PI*PI/6;
+      const Complex<double> rest_ref = u*lv + PI*PI/6;
+      const Complex<double> rest(inv ? rest_inv.re : ref ? rest_ref.re : 0.0,
+                                 inv ? rest_inv.im : ref ? rest_ref.im : 0.0);
+      const double sgn = inv || ref ? -1 : 1;
+
+      const Complex<double> u2(u*u);
+      const Complex<double> res = sgn*(u + u2*(bf[0] + u*detail::li_coeffs::horner<1, 10>(u2, bf))) + rest;
+      const Complex<double> small = z*(1.0 + 0.25*z);
+      const bool is_small = nz < std::numeric_limits<double>::epsilon();
+
+      out_re[i] = is_small ? small.re : res.re;
+      out_im[i] = is_small ? small.im : res.im;
+   }
+
+   // special cases
+   for (std::size_t i = 0; i < n; ++i) {
+      if (im[i] == 0) {
+         const std::complex<double> li2 = Li2(std::complex<double>(re[i], im[i]));
+         out_re[i] = std::real(li2);
+         out_im[i] = std::imag(li2);
+      }
+   }
 }
 
 /**
@@ -463,41 +601,11 @@ std::complex<double> Li2(const std::complex<double>& z_) noexcept
  * @author Werner Porod
  * @note translated to C++ and extended to long double precision by Alexander Voigt
  */
-std::complex<long double> Li2(const std::complex<long double>& z_) noexcept
+POLYLOGARITHM_INLINE std::complex<long double> Li2(const std::complex<long double>& z_) noexcept
 {
    const long double PI = 3.14159265358979323846264338327950288L;
    const Complex<long double> z = { std::real(z_), std::imag(z_) };
 
-   // bf[1..N-1] are the even Bernoulli numbers / (2 n + 1)!
-   // generated by: Table[BernoulliB[2 n]/(2 n + 1)!, {n, 1, 22}]
-   const long double bf[] = {
-      -1.0L/4.0L                                 ,
-       1.0L/36.0L                                ,
-      -1.0L/3600.0L                              ,
-       1.0L/211680.0L                            ,
-      -1.0L/10886400.0L                          ,
-       1.0L/526901760.0L                         ,
-      -4.06476164514422552680590938629196667e-11L,
-       8.92169102045645255521798731675274885e-13L,
-      -1.99392958607210756872364434779378971e-14L,
-       4.51898002961991819165047655285559323e-16L,
-      -1.03565176121812470144834115422186567e-17L,
-#if LDBL_DIG > 18
-       2.39521862102618674574028374300098038e-19L,
-      -5.58178587432500933628307450562541991e-21L,
-       1.30915075541832128581230739918659230e-22L,
-      -3.08741980242674029324227976486646243e-24L,
-       7.31597565270220342035790560925214859e-26L,
-      -1.74084565723400074098905514775970255e-27L,
-       4.15763564461389971961789962077522667e-29L,
-      -9.96214848828462210319400670245583885e-31L,
-       2.39403442489616530052116798789374956e-32L,
-      -5.76834735536739008429179316187765424e-34L,
-       1.39317947964700797782788660391154833e-35L,
-      -3.37212196548508947046847363525493096e-37L
-#endif
-   };
-
    // special cases
    if (z.im == 0) {
       if (z.re <= 1) {
@@ -507,43 +615,7 @@ std::complex<long double> Li2(const std::complex<long double>& z_) noexcept
       return { Li2(z.re), -PI*std::log(z.re) };
    }
 
-   const long double nz = norm_sqr(z);
-
-   if (nz < std::numeric_limits<long double>::epsilon()) {
-      return z*(1.0L + 0.25L*z);
-   }
-
-   Complex<long double> u(0.0L, 0.0L), rest(0.0L, 0.0L);
-   long double sgn = 1;
-
-   // transformation to |z|<1, Re(z)<=0.5
-   if (z.re <= 0.5L) {
-      if (nz > 1) {
-         const Complex<long double> lz = log(-z);
-         u = -log(1.0L - 1.0L/z);
-         rest = -0.5L*lz*lz - PI*PI/6;
-         sgn = -1;
-      } else { // nz <= 1
-         u = -log(1.0L - z);
-         rest = 0;
-         sgn = 1;
-      }
-   } else { // z.re > 0.5L
-      if (nz <= 2*z.re) {
-         u = -log(z);
-         rest = u*log(1.0L - z) + PI*PI/6;
-         sgn = -1;
-      } else { // nz > 2*z.re
-         const Complex<long double> lz = log(-z);
-         u = -log(1.0L - 1.0L/z);
-         rest = -0.5L*lz*lz - PI*PI/6;
-         sgn = -1;
-      }
-   }
-
-   const Complex<long double> u2(u*u);
-
-   return sgn*(u + u2*(bf[0] + u*horner<1>(u2, bf))) + rest;
+   return detail::li_kernel::li2(z);
 }
 
 } // namespace polylogarithm
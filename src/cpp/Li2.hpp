@@ -5,7 +5,10 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 #include <complex>
+#include <cstddef>
+#include <vector>
 
 namespace polylogarithm {
 
@@ -18,6 +21,15 @@ double Li2(double) noexcept;
 /// real polylogarithm with n=2 (dilogarithm) with long double precision
 long double Li2(long double) noexcept;
 
+/// real polylogarithm with n=2 (dilogarithm) with reduced accuracy of about 1e-11
+double Li2_fast(double) noexcept;
+
+/// real polylogarithm with n=2 (dilogarithm) for an array of n doubles
+void Li2(const double* x, double* out, std::size_t n) noexcept;
+
+/// real polylogarithm with n=2 (dilogarithm) for a vector of doubles
+std::vector<double> Li2(const std::vector<double>&);
+
 /// complex polylogarithm with n=2 (dilogarithm) with single precision
 std::complex<float> Li2(const std::complex<float>&) noexcept;
 
@@ -27,4 +39,11 @@ std::complex<double> Li2(const std::complex<double>&) noexcept;
 /// complex polylogarithm with n=2 (dilogarithm) with long double precision
 std::complex<long double> Li2(const std::complex<long double>&) noexcept;
 
+/// complex polylogarithm with n=2 (dilogarithm) for n complex numbers in structure-of-arrays layout
+void Li2(const double* re, const double* im, double* out_re, double* out_im, std::size_t n) noexcept;
+
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li2.cpp"
+#endif
@@ -5,34 +5,53 @@
 // ====================================================================
 
 #include "Li3.hpp"
+#include "branch_counter.hpp"
 #include "complex.hpp"
-#include <cfloat>
+#include "li_coeffs.hpp"
+#include "li_kernel.hpp"
 #include <cmath>
 
 namespace polylogarithm {
 
-namespace {
+namespace detail {
+namespace li3 {
 
-   template <typename T, int N>
-   Complex<T> horner(const Complex<T>& z, const T (&coeffs)[N]) noexcept
+   /// Li_3(x) for x in [-1,0] with single precision
+   POLYLOGARITHM_INLINE float li3_neg(float x) noexcept
    {
-      static_assert(N >= 2, "more than two coefficients required");
+      const float cp[] = {
+         9.99999995e-01f, -6.61784205e-01f, 5.77341429e-02f, 1.32595191e-03f
+      };
+      const float cq[] = {
+         1.00000000e+00f, -7.86783732e-01f, 1.19052168e-01f
+      };
 
-      const T r = z.re + z.re;
-      const T s = z.re * z.re + z.im * z.im;
-      T a = coeffs[N - 1], b = coeffs[N - 2];
+      const float x2 = x*x;
+      const float p = cp[0] + x*cp[1] + x2*(cp[2] + x*cp[3]);
+      const float q = cq[0] + x*cq[1] + x2*cq[2];
 
-      for (int i = N - 3; i >= 0; --i) {
-         const T t = a;
-         a = b + r * a;
-         b = coeffs[i] - s * t;
-      }
+      return x*p/q;
+   }
+
+   /// Li_3(x) for x in [0,1/2] with single precision
+   POLYLOGARITHM_INLINE float li3_pos(float x) noexcept
+   {
+      const float cp[] = {
+         9.99999997e-01f, -8.65654412e-01f, 1.17996690e-01f, 4.57214970e-03f
+      };
+      const float cq[] = {
+         1.00000000e+00f, -9.90654714e-01f, 2.04797202e-01f
+      };
+
+      const float x2 = x*x;
+      const float p = cp[0] + x*cp[1] + x2*(cp[2] + x*cp[3]);
+      const float q = cq[0] + x*cq[1] + x2*cq[2];
 
-      return Complex<T>(z.re*a + b, z.im*a);
+      return x*p/q;
    }
 
    /// Li_3(x) for x in [-1,0]
-   double li3_neg(double x) noexcept
+   POLYLOGARITHM_INLINE double li3_neg(double x) noexcept
    {
       const double cp[] = {
          0.9999999999999999795e+0, -2.0281801754117129576e+0,
@@ -57,7 +76,7 @@ namespace {
    }
 
     /// Li_3(x) for x in [0,1/2]
-    double li3_pos(double x) noexcept
+    POLYLOGARITHM_INLINE double li3_pos(double x) noexcept
     {
        const double cp[] = {
           0.9999999999999999893e+0, -2.5224717303769789628e+0,
@@ -81,75 +100,262 @@ namespace {
        return x*p/q;
    }
 
-} // anonymous namespace
+   /// Li_3(x) for x in [-1,0] with a relative error of 2e-10
+   POLYLOGARITHM_INLINE double li3_neg_fast(double x) noexcept
+   {
+      const double cp[] = {
+         9.9999999983855092e-01, -9.2780643058554912e-01,
+         1.8915196023527375e-01, -4.2549572597575030e-03
+      };
+      const double cq[] = {
+         1.0000000000000000e+00, -1.0528064096179570e+00,
+         2.8371616353794027e-01, -1.6348123731638031e-02
+      };
+
+      const double x2 = x*x;
+      const double p = cp[0] + x*cp[1] + x2*(cp[2] + x*cp[3]);
+      const double q = cq[0] + x*cq[1] + x2*(cq[2] + x*cq[3]);
+
+      return x*p/q;
+   }
+
+   /// Li_3(x) for x in [0,1/2] with a relative error of 1e-10
+   POLYLOGARITHM_INLINE double li3_pos_fast(double x) noexcept
+   {
+      const double cp[] = {
+         1.0000000000851403e+00, -1.1944343757850946e+00,
+         3.4861140657041523e-01, -1.4046108291387882e-02
+      };
+      const double cq[] = {
+         1.0000000000000000e+00, -1.3194343627058878e+00,
+         4.7650333172805598e-01, -4.0362950843896628e-02
+      };
+
+      const double x2 = x*x;
+      const double p = cp[0] + x*cp[1] + x2*(cp[2] + x*cp[3]);
+      const double q = cq[0] + x*cq[1] + x2*(cq[2] + x*cq[3]);
+
+      return x*p/q;
+   }
+
+   /// Li3(x) for real x, using the transformations to [-1, 0] and
+   /// [0, 1/2], where neg(y) and pos(y) approximate Li3(y) for y in
+   /// [-1, 0] and [0, 1/2], respectively
+   template <double (*neg)(double), double (*pos)(double)>
+   double li3_real(double x) noexcept
+   {
+      const double zeta2 = 1.6449340668482264;
+      const double zeta3 = 1.2020569031595943;
+
+      // transformation to [-1,0] and [0,1/2]
+      if (x < -1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_lt_m1);
+         const double l = std::log(-x);
+         return neg(1/x) - l*(zeta2 + 1.0/6*l*l);
+      } else if (x == -1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_eq_m1);
+         return -0.75*zeta3;
+      } else if (x < 0) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_lt_0);
+         return neg(x);
+      } else if (x == 0) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_eq_0);
+         return 0;
+      } else if (x < 0.5) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_lt_half);
+         return pos(x);
+      } else if (x == 0.5) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_eq_half);
+         return 0.53721319360804020;
+      } else if (x < 1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_lt_1);
+         const double l = std::log(x);
+         return -neg(1 - 1/x) - pos(1 - x)
+            + zeta3 + l*(zeta2 + l*(-0.5*std::log1p(-x) + 1.0/6*l));
+      } else if (x == 1) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_eq_1);
+         return zeta3;
+      } else if (x < 2) {
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_lt_2);
+         const double l = std::log(x);
+         return -neg(1 - x) - pos(1 - 1/x)
+            + zeta3 + l*(zeta2 + l*(-0.5*std::log(x - 1) + 1.0/6*l));
+      } else { // x >= 2.0
+         POLYLOGARITHM_COUNT_BRANCH(Li3_x_ge_2);
+         const double l = std::log(x);
+         return pos(1/x) + l*(2*zeta2 - 1.0/6*l*l);
+      }
+   }
+
+} // namespace li3
+} // namespace detail
 
 /**
- * @brief Real trilogarithm \f$\operatorname{Li}_3(x)\f$
+ * @brief Real trilogarithm \f$\operatorname{Li}_3(x)\f$ with single precision
  * @param x real argument
  * @return \f$\operatorname{Li}_3(x)\f$
  * @author Alexander Voigt
+ *
+ * Implemented as rational function approximations with a maximum
+ * error of approximately 5e-9 (before rounding to single precision).
  */
-double Li3(double x) noexcept
+POLYLOGARITHM_INLINE float Li3(float x) noexcept
 {
-   const double zeta2 = 1.6449340668482264;
-   const double zeta3 = 1.2020569031595943;
+   const float zeta2 = 1.64493407f;
+   const float zeta3 = 1.20205690f;
 
    // transformation to [-1,0] and [0,1/2]
    if (x < -1) {
-      const double l = std::log(-x);
-      return li3_neg(1/x) - l*(zeta2 + 1.0/6*l*l);
+      const float l = std::log(-x);
+      return detail::li3::li3_neg(1/x) - l*(zeta2 + 1.0f/6*l*l);
    } else if (x == -1) {
-      return -0.75*zeta3;
+      return -0.75f*zeta3;
    } else if (x < 0) {
-      return li3_neg(x);
+      return detail::li3::li3_neg(x);
    } else if (x == 0) {
       return 0;
-   } else if (x < 0.5) {
-      return li3_pos(x);
-   } else if (x == 0.5) {
-      return 0.53721319360804020;
+   } else if (x < 0.5f) {
+      return detail::li3::li3_pos(x);
+   } else if (x == 0.5f) {
+      return 0.537213194f;
    } else if (x < 1) {
-      const double l = std::log(x);
-      return -li3_neg(1 - 1/x) - li3_pos(1 - x)
-         + zeta3 + l*(zeta2 + l*(-0.5*std::log1p(-x) + 1.0/6*l));
+      const float l = std::log(x);
+      return -detail::li3::li3_neg(1 - 1/x) - detail::li3::li3_pos(1 - x)
+         + zeta3 + l*(zeta2 + l*(-0.5f*std::log1p(-x) + 1.0f/6*l));
    } else if (x == 1) {
       return zeta3;
    } else if (x < 2) {
-      const double l = std::log(x);
-      return -li3_neg(1 - x) - li3_pos(1 - 1/x)
-         + zeta3 + l*(zeta2 + l*(-0.5*std::log(x - 1) + 1.0/6*l));
+      const float l = std::log(x);
+      return -detail::li3::li3_neg(1 - x) - detail::li3::li3_pos(1 - 1/x)
+         + zeta3 + l*(zeta2 + l*(-0.5f*std::log(x - 1) + 1.0f/6*l));
    } else { // x >= 2.0
-      const double l = std::log(x);
-      return li3_pos(1/x) + l*(2*zeta2 - 1.0/6*l*l);
+      const float l = std::log(x);
+      return detail::li3::li3_pos(1/x) + l*(2*zeta2 - 1.0f/6*l*l);
    }
 }
 
+/**
+ * @brief Real trilogarithm \f$\operatorname{Li}_3(x)\f$
+ * @param x real argument
+ * @return \f$\operatorname{Li}_3(x)\f$
+ * @author Alexander Voigt
+ */
+POLYLOGARITHM_INLINE double Li3(double x) noexcept
+{
+   return detail::li3::li3_real<detail::li3::li3_neg, detail::li3::li3_pos>(x);
+}
+
+/**
+ * @brief Real trilogarithm \f$\operatorname{Li}_3(x)\f$ with reduced accuracy
+ * @param x real argument
+ * @return \f$\operatorname{Li}_3(x)\f$
+ * @author Alexander Voigt
+ *
+ * Same transformations as Li3(double), but with lower-degree rational
+ * function approximations with a maximum error of approximately 2e-10
+ * (relative, or absolute where |Li3(x)| < 1).  The branches are
+ * counted like those of Li3(double).
+ */
+POLYLOGARITHM_INLINE double Li3_fast(double x) noexcept
+{
+   return detail::li3::li3_real<detail::li3::li3_neg_fast, detail::li3::li3_pos_fast>(x);
+}
+
+/**
+ * @brief Complex trilogarithm \f$\operatorname{Li}_3(z)\f$ with single precision
+ * @param z_ complex argument
+ * @return \f$\operatorname{Li}_3(z)\f$
+ * @author Alexander Voigt
+ *
+ * Same algorithm as for double precision, with the series truncated
+ * for single precision.
+ */
+POLYLOGARITHM_INLINE std::complex<float> Li3(const std::complex<float>& z_) noexcept
+{
+   const float PI    = 3.14159265f;
+   const float zeta2 = 1.64493407f;
+   const float zeta3 = 1.20205690f;
+   const float bf[10] = {
+      1.0f                  , -3.0f/8.0f             ,
+      17.0f/216.0f          , -5.0f/576.0f           ,
+      1.29629630e-04f       ,  8.10185185e-05f       ,
+     -3.41935716e-06f       , -1.32865646e-06f       ,
+      8.66087176e-08f       ,  2.52608760e-08f
+   };
+
+   const Complex<float> z = { std::real(z_), std::imag(z_) };
+
+   if (z.im == 0) {
+      if (z.re <= 1) {
+         return Li3(z.re);
+      } else {
+         const float l = std::log(z.re);
+         return std::complex<float>(Li3(z.re), -0.5f*PI*l*l);
+      }
+   }
+
+   const float nz  = norm(z);
+   const float pz  = arg(z);
+   const float lnz = std::log(nz);
+
+   if (lnz*lnz + pz*pz < 1) { // |log(z)| < 1
+      const Complex<float> u(lnz, pz); // log(z)
+      const Complex<float> u2 = u*u;
+      const Complex<float> u4 = u2*u2;
+      const Complex<float> c0 = zeta3 + u*(zeta2 - u2/12.0f);
+      const Complex<float> c1 = 0.25f * (3.0f - 2.0f*log(-u));
+
+      const float cs[3] = {
+         -3.47222222e-03f, 1.15740741e-05f, -9.84189972e-08f
+      };
+
+      return
+         c0 +
+         c1*u2 +
+         u4*(cs[0] + u2*cs[1]) +
+         u4*u4*cs[2];
+   }
+
+   Complex<float> u(0.0f, 0.0f), rest(0.0f, 0.0f);
+
+   if (nz <= 1) {
+      u = -log1p(-z);
+   } else { // nz > 1
+      const float arg = pz > 0.0f ? pz - PI : pz + PI;
+      const Complex<float> lmz(lnz, arg); // log(-z)
+      u = -log1p(-1.0f/z);
+      rest = -lmz*(lmz*lmz/6.0f + zeta2);
+   }
+
+   const Complex<float> u2 = u*u;
+   const Complex<float> u4 = u2*u2;
+   const Complex<float> u8 = u4*u4;
+
+   return
+      rest +
+      u*bf[0] +
+      u2*(bf[1] + u*bf[2]) +
+      u4*(bf[3] + u*bf[4] + u2*(bf[5] + u*bf[6])) +
+      u8*(bf[7] + u*bf[8] + u2*bf[9]);
+}
+
 /**
  * @brief Complex trilogarithm \f$\operatorname{Li}_3(z)\f$
  * @param z_ complex argument
  * @return \f$\operatorname{Li}_3(z)\f$
  * @author Alexander Voigt
  */
-std::complex<double> Li3(const std::complex<double>& z_) noexcept
+POLYLOGARITHM_INLINE std::complex<double> Li3(const std::complex<double>& z_) noexcept
 {
    const double PI    = 3.1415926535897932;
    const double zeta2 = 1.6449340668482264;
    const double zeta3 = 1.2020569031595943;
-   const double bf[18] = {
-      1.0                   , -3.0/8.0               ,
-      17.0/216.0            , -5.0/576.0             ,
-      1.2962962962962963e-04,  8.1018518518518519e-05,
-     -3.4193571608537595e-06, -1.3286564625850340e-06,
-      8.6608717561098513e-08,  2.5260875955320400e-08,
-     -2.1446944683640648e-09, -5.1401106220129789e-10,
-      5.2495821146008294e-11,  1.0887754406636318e-11,
-     -1.2779396094493695e-12, -2.3698241773087452e-13,
-      3.1043578879654623e-14,  5.2617586299125061e-15
-   };
+   const auto& bf = detail::li_coeffs::Tables<>::li3_bf;
 
    const Complex<double> z = { std::real(z_), std::imag(z_) };
 
    if (z.im == 0) {
+      POLYLOGARITHM_COUNT_BRANCH(Li3_z_real);
       if (z.re <= 1) {
          return Li3(z.re);
       } else {
@@ -163,6 +369,7 @@ std::complex<double> Li3(const std::complex<double>& z_) noexcept
    const double lnz = std::log(nz);
 
    if (lnz*lnz + pz*pz < 1) { // |log(z)| < 1
+      POLYLOGARITHM_COUNT_BRANCH(Li3_z_log_lt_1);
       const Complex<double> u(lnz, pz); // log(z)
       const Complex<double> u2 = u*u;
       const Complex<double> u4 = u2*u2;
@@ -170,12 +377,7 @@ std::complex<double> Li3(const std::complex<double>& z_) noexcept
       const Complex<double> c0 = zeta3 + u*(zeta2 - u2/12.0);
       const Complex<double> c1 = 0.25 * (3.0 - 2.0*log(-u));
 
-      const double cs[7] = {
-         -3.4722222222222222e-03, 1.1574074074074074e-05,
-         -9.8418997228521038e-08, 1.1482216343327454e-09,
-         -1.5815724990809166e-11, 2.4195009792525152e-13,
-         -3.9828977769894877e-15
-      };
+      const auto& cs = detail::li_coeffs::Tables<>::li3_cs;
 
       return
          c0 +
@@ -188,8 +390,10 @@ std::complex<double> Li3(const std::complex<double>& z_) noexcept
    Complex<double> u(0.0, 0.0), rest(0.0, 0.0);
 
    if (nz <= 1) {
+      POLYLOGARITHM_COUNT_BRANCH(Li3_z_abs_le_1);
       u = -log(1.0 - z);
    } else { // nz > 1
+      POLYLOGARITHM_COUNT_BRANCH(Li3_z_abs_gt_1);
       const double arg = pz > 0.0 ? pz - PI : pz + PI;
       const Complex<double> lmz(lnz, arg); // log(-z)
       u = -log(1.0 - 1.0/z);
@@ -216,128 +420,9 @@ std::complex<double> Li3(const std::complex<double>& z_) noexcept
  * @return \f$\operatorname{Li}_3(z)\f$
  * @author Alexander Voigt
  */
-std::complex<long double> Li3(const std::complex<long double>& z_) noexcept
+POLYLOGARITHM_INLINE std::complex<long double> Li3(const std::complex<long double>& z_) noexcept
 {
-   const long double PI    = 3.14159265358979323846264338327950288L;
-   const long double zeta2 = 1.64493406684822643647241516664602519L;
-   const long double zeta3 = 1.20205690315959428539973816151144999L;
-   const long double bf[] = {
-      1.0L,
-     -3.0L/8.0L,
-      17.0L/216.0L,
-     -5.0L/576.0L,
-      7.0L/54000.0L,
-      7.0L/86400.0L,
-     -3.41935716085375949321527552820069827e-06L,
-     -1.32865646258503401360544217687074830e-06L,
-      8.66087175610985134794658604182413706e-08L,
-      2.52608759553203997648442092886537331e-08L,
-     -2.14469446836406476093388507573649032e-09L,
-     -5.14011062201297891533581769272004962e-10L,
-      5.24958211460082943639408880855807284e-11L,
-      1.08877544066363183753729715704249107e-11L,
-     -1.27793960944936953055818317540722120e-12L,
-     -2.36982417730874520997977788101244891e-13L,
-      3.10435788796546229428475327046556211e-14L,
-      5.26175862991250608413183925112250061e-15L,
-     -7.53847954994926536599250143226771028e-16L,
-     -1.18623225777522852530825009512459322e-16L,
-      1.83169799654913833820892731212815349e-17L,
-      2.70681710318373501514907347126169436e-18L,
-#if LDBL_DIG > 18
-     -4.45543389782963882643263099217632212e-19L,
-     -6.23754849225569465036532224739838641e-20L,
-      1.08515215348745349131365609968642833e-20L,
-      1.44911748660360819307349049665275324e-21L,
-     -2.64663397544589903347408911861443741e-22L,
-     -3.38976534885101047219258165860814078e-23L,
-      6.46404773360331088903253098219534234e-24L,
-      7.97583448960241242420922272590502795e-25L,
-     -1.58091787902874833559211176293826770e-25L,
-     -1.88614997296228681931102253988531956e-26L,
-      3.87155366384184733039971271888313319e-27L,
-      4.48011750023456073048653898320511684e-28L,
-     -9.49303387191183612641753676027699150e-29L,
-     -1.06828138090773812240182143033807908e-29L,
-      2.33044789361030518600785199019281371e-30L,
-      2.55607757265197540805635698286695865e-31L,
-     -5.72742160613725968447274458033057100e-32L,
-     -6.13471321379642358258549296897773326e-33L,
-      1.40908086040689448401268688489421700e-33L,
-      1.47642223976665341443182801167106626e-34L,
-     -3.47010516489959160555004020312910903e-35L,
-     -3.56210662409746357967357370318293608e-36L,
-      8.55369656823692105754731289124468101e-37L
-#endif
-   };
-
-   const Complex<long double> z = { std::real(z_), std::imag(z_) };
-
-   if (z.im == 0) {
-      if (z.re == 0) {
-         return 0.0L;
-      }
-      if (z.re == 1) {
-         return zeta3;
-      }
-      if (z.re == -1) {
-         return -0.75L*zeta3;
-      }
-      if (z.re == 0.5L) {
-         return 0.537213193608040200940623225594965827L;
-      }
-   }
-
-   const long double nz  = norm(z);
-   const long double pz  = arg(z);
-   const long double lnz = std::log(nz);
-
-   if (lnz*lnz + pz*pz < 1) { // |log(z)| < 1
-      const Complex<long double> u(lnz, pz); // log(z)
-      const Complex<long double> u2 = u*u;
-      const Complex<long double> c0 = zeta3 + u*(zeta2 - u2/12.0L);
-      const Complex<long double> c1 = 0.25L * (3.0L - 2.0L*log(-u));
-
-      const long double cs[] = {
-        -3.47222222222222222222222222222222222e-03L,
-         1.15740740740740740740740740740740741e-05L,
-        -9.84189972285210380448475686570924666e-08L,
-         1.14822163433274544385655496766607878e-09L,
-        -1.58157249908091658933409775160616911e-11L,
-         2.41950097925251519452732701564998016e-13L,
-        -3.98289777698948774786517290926462002e-15L,
-         6.92336661830592905806820954095065870e-17L,
-        -1.25527223044997727545846570912655367e-18L,
-#if LDBL_DIG > 18
-         2.35375400276846523056441171414060379e-20L,
-        -4.53639890345868701844750708901700830e-22L,
-         8.94516967039264316712031170773304472e-24L,
-        -1.79828400469549627172020247141015426e-25L,
-         3.67549976479373844433604733912674099e-27L,
-        -7.62080797156479522953948500963765478e-29L,
-         1.60004196436948597517376392257325602e-30L,
-        -3.39676114756037558792312060520851852e-32L,
-         7.28227228675776469531725636144432664e-34L,
-        -1.57502264795800348718497893940378261e-35L,
-         3.43354009248058933588797212016527038e-37L
-#endif
-      };
-
-      return c0 + u2*(c1 + u2*horner(u2, cs));
-   }
-
-   Complex<long double> u(0.0L, 0.0L), rest(0.0L, 0.0L);
-
-   if (nz <= 1) {
-      u = -log(1.0L - z);
-   } else { // nz > 1
-      const long double arg = pz > 0.0 ? pz - PI : pz + PI;
-      const Complex<long double> lmz(lnz, arg); // log(-z)
-      u = -log(1.0L - 1.0L/z);
-      rest = -lmz*(lmz*lmz/6.0L + zeta2);
-   }
-
-   return rest + u*horner(u, bf);
+   return detail::li_kernel::li3(Complex<long double>(std::real(z_), std::imag(z_)));
 }
 
 } // namespace polylogarithm
@@ -5,13 +5,31 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 #include <complex>
+#include <type_traits>
 
 namespace polylogarithm {
 
+/// real polylogarithm with n=3 (trilogarithm) with single precision
+float Li3(float) noexcept;
+
 /// real polylogarithm with n=3 (trilogarithm)
 double Li3(double) noexcept;
 
+/// real polylogarithm with n=3 (trilogarithm) for integral arguments, evaluated in double precision
+template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+double Li3(T x) noexcept
+{
+   return Li3(static_cast<double>(x));
+}
+
+/// real polylogarithm with n=3 (trilogarithm) with reduced accuracy of about 1e-10
+double Li3_fast(double) noexcept;
+
+/// complex polylogarithm with n=3 (trilogarithm) with single precision
+std::complex<float> Li3(const std::complex<float>&) noexcept;
+
 /// complex polylogarithm with n=3 (trilogarithm)
 std::complex<double> Li3(const std::complex<double>&) noexcept;
 
@@ -19,3 +37,7 @@ std::complex<double> Li3(const std::complex<double>&) noexcept;
 std::complex<long double> Li3(const std::complex<long double>&) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li3.cpp"
+#endif
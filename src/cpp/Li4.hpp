@@ -5,13 +5,28 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 #include <complex>
+#include <type_traits>
 
 namespace polylogarithm {
 
+/// real polylogarithm with n=4 with single precision
+float Li4(float) noexcept;
+
 /// real polylogarithm with n=4
 double Li4(double) noexcept;
 
+/// real polylogarithm with n=4 for integral arguments, evaluated in double precision
+template <typename T, typename std::enable_if<std::is_integral<T>::value, int>::type = 0>
+double Li4(T x) noexcept
+{
+   return Li4(static_cast<double>(x));
+}
+
+/// complex polylogarithm with n=4 with single precision
+std::complex<float> Li4(const std::complex<float>&) noexcept;
+
 /// complex polylogarithm with n=4
 std::complex<double> Li4(const std::complex<double>&) noexcept;
 
@@ -19,3 +34,7 @@ std::complex<double> Li4(const std::complex<double>&) noexcept;
 std::complex<long double> Li4(const std::complex<long double>&) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li4.cpp"
+#endif
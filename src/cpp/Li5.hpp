@@ -5,10 +5,14 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
 #include <complex>
 
 namespace polylogarithm {
 
+/// complex polylogarithm with n=5 with single precision
+std::complex<float> Li5(const std::complex<float>&) noexcept;
+
 /// complex polylogarithm with n=5
 std::complex<double> Li5(const std::complex<double>&) noexcept;
 
@@ -16,3 +20,7 @@ std::complex<double> Li5(const std::complex<double>&) noexcept;
 std::complex<long double> Li5(const std::complex<long double>&) noexcept;
 
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li5.cpp"
+#endif
@@ -0,0 +1,234 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "LiPlan.hpp"
+#include "Li.hpp"
+#include "eta.hpp"
+#include "factorial.hpp"
+#include "harmonic.hpp"
+#include "li_detail.hpp"
+#include "zeta.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace polylogarithm {
+
+namespace detail {
+namespace li_plan {
+   /// order from which on the plan pre-computes coefficients
+   constexpr int64_t N_PLAN = 7;
+
+   /// number of pre-computed weights of the series in powers of z
+   constexpr std::size_t N_SERIES = 256;
+
+   /// number of pre-computed terms of the series around z ~ 1
+   constexpr std::size_t N_TAIL = 64;
+
+   /// zeta(n) rounds to 1 in double precision for n >= N_ZETA_ONE
+   constexpr int64_t N_ZETA_ONE = 54;
+
+} // namespace li_plan
+} // namespace detail
+
+/**
+ * @brief Pre-computes the coefficients for Li(n, z)
+ * @param n_ degree of the polylogarithm
+ *
+ * The memory footprint is bounded independently of n: only the
+ * zeta values zeta(n - j) != 1 and the corresponding 1/j are stored.
+ */
+POLYLOGARITHM_INLINE LiPlan::LiPlan(int64_t n_)
+   : n(n_)
+{
+   if (n < detail::li_plan::N_PLAN) {
+      return;
+   }
+
+   zeta_n = zeta(n);
+   neg_eta_n = neg_eta(n);
+   harmonic_n1 = harmonic(n - 1);
+   inv_fac_n = inv_fac(n);
+
+   series_weights.resize(detail::li_plan::N_SERIES);
+   for (std::size_t k = 1; k <= detail::li_plan::N_SERIES; ++k) {
+      series_weights[k - 1] = detail::li::pow_int(static_cast<double>(k), n);
+   }
+
+   // zeta(n - j) rounds to 1 for n - j >= N_ZETA_ONE, only the
+   // remaining terms are stored, so that the memory does not grow with n
+   j_unity = std::max(static_cast<int64_t>(0), n - detail::li_plan::N_ZETA_ONE);
+
+   for (int64_t j = j_unity + 1; j < n - 1; ++j) {
+      zeta_head.push_back(zeta(n - j));
+   }
+
+   for (int64_t j = j_unity + 1; j <= n + 1; ++j) {
+      inv_j.push_back(1.0/static_cast<double>(j));
+   }
+
+   zeta_tail.resize(detail::li_plan::N_TAIL);
+   inv_tail.resize(detail::li_plan::N_TAIL);
+   for (std::size_t i = 0; i < detail::li_plan::N_TAIL; ++i) {
+      const int64_t j = n + 3 + 2*static_cast<int64_t>(i);
+      zeta_tail[i] = zeta(n - j);
+      inv_tail[i] = 1.0/static_cast<double>((j - 1)*j);
+   }
+
+   const int64_t kmax = detail::li::is_even(n) ? n/2 : (n - 1)/2;
+   for (int64_t k = kmax; k != 0; --k) {
+      const double ifac = inv_fac(n - 2*k);
+      if (ifac == 0) {
+         rest_truncated = true;
+         break;
+      }
+      rest_coeffs.push_back(neg_eta(2*k)*ifac);
+   }
+}
+
+/// Series expansion of Li_n(z) in terms of powers of z.
+POLYLOGARITHM_INLINE std::complex<double> LiPlan::series(const std::complex<double>& z) const noexcept
+{
+   std::complex<double> sum = z, sum_old(0.0, 0.0), zk = z;
+   int64_t k = 1;
+
+   do {
+      k++;
+      zk *= z;
+      const double w = static_cast<std::size_t>(k) <= series_weights.size()
+         ? series_weights[k - 1] : detail::li::pow_int(static_cast<double>(k), n);
+      const std::complex<double> term = zk/w;
+      if (!detail::li::is_finite(term)) { break; }
+      sum_old = sum;
+      sum += term;
+   } while (sum != sum_old &&
+            k < std::numeric_limits<int64_t>::max() - 2);
+
+   return sum;
+}
+
+/// Series expansion of Li_n(z) around z ~ 1, n > 0
+POLYLOGARITHM_INLINE std::complex<double> LiPlan::unity_pos(const std::complex<double>& z) const noexcept
+{
+   const std::complex<double> lnz = detail::li::clog(z);
+   const std::complex<double> lnz2 = lnz*lnz;
+   std::complex<double> sum(zeta_n, 0.0), p(1.0, 0.0);
+
+   for (int64_t j = 1; j <= j_unity; ++j) {
+      p *= lnz/static_cast<double>(j);
+      sum += p; // zeta(n - j) = 1
+   }
+
+   for (int64_t j = j_unity + 1; j < n - 1; ++j) {
+      p *= lnz*inv_j[j - j_unity - 1];
+      sum += zeta_head[j - j_unity - 1]*p;
+   }
+
+   p *= lnz*inv_j[n - j_unity - 2];
+   sum += (harmonic_n1 - detail::li::clog(-lnz))*p;
+
+   p *= lnz*inv_j[n - j_unity - 1];
+   sum += -0.5*p; // zeta(0)
+
+   p *= lnz*inv_j[n - j_unity];
+   sum += (-1.0/12)*p; // zeta(-1)
+
+   for (std::size_t i = 0; i < zeta_tail.size(); ++i) {
+      p *= lnz2*inv_tail[i];
+      const auto old_sum = sum;
+      sum += zeta_tail[i]*p;
+      if (sum == old_sum) { return sum; }
+   }
+
+   for (int64_t j = n + 3 + 2*static_cast<int64_t>(zeta_tail.size());
+        j < std::numeric_limits<int64_t>::max() - 2; j += 2) {
+      p *= lnz2/static_cast<double>((j - 1)*j);
+      const auto old_sum = sum;
+      sum += zeta(n - j)*p;
+      if (sum == old_sum) { break; }
+   }
+
+   return sum;
+}
+
+/// returns remainder from inversion formula
+POLYLOGARITHM_INLINE std::complex<double> LiPlan::rest(const std::complex<double>& z) const noexcept
+{
+   const std::complex<double> lnz = detail::li::clog(-z);
+   const std::complex<double> lnz2 = lnz*lnz;
+   std::complex<double> p = detail::li::is_even(n) ? 1.0 : lnz;
+   std::complex<double> sum(0.0, 0.0);
+
+   for (const double c: rest_coeffs) {
+      sum += c*p;
+      p *= lnz2;
+      if (sum == 0.0) { break; }
+   }
+
+   if (rest_truncated) {
+      return 2.0*sum;
+   }
+
+   return 2.0*sum - p*inv_fac_n;
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_n(z)\f$
+ * @param z complex argument
+ * @return \f$\operatorname{Li}_n(z)\f$
+ * @author Alexander Voigt
+ */
+POLYLOGARITHM_INLINE std::complex<double> LiPlan::operator()(const std::complex<double>& z) const noexcept
+{
+   if (n < detail::li_plan::N_PLAN) {
+      return Li(n, z);
+   }
+
+   if (std::isnan(std::real(z)) || std::isnan(std::imag(z))) {
+      return {detail::li::nan, detail::li::nan};
+   } else if (std::isinf(std::real(z)) || std::isinf(std::imag(z))) {
+      return {-detail::li::inf, 0.0};
+   } else if (z == 0.0) {
+      return {0.0, 0.0};
+   } else if (z == 1.0) {
+      return {zeta_n, 0.0};
+   } else if (z == -1.0) {
+      return {neg_eta_n, 0.0};
+   } else if (std::norm(z) <= 0.75*0.75) {
+      return series(z);
+   } else if (std::norm(z) >= 1.4*1.4) {
+      const double sgn = detail::li::is_even(n) ? -1.0 : 1.0;
+      return sgn*series(1.0/z) + rest(z);
+   }
+   return unity_pos(z);
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_n(z)\f$ for an array
+ * @param z array of complex arguments
+ * @param out array of size count, filled with \f$\operatorname{Li}_n(z)\f$
+ * @param count number of elements
+ */
+POLYLOGARITHM_INLINE void LiPlan::operator()(const std::complex<double>* z, std::complex<double>* out, std::size_t count) const noexcept
+{
+   for (std::size_t i = 0; i < count; ++i) {
+      out[i] = (*this)(z[i]);
+   }
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_n(z)\f$ for a vector
+ * @param z vector of complex arguments
+ * @return vector of \f$\operatorname{Li}_n(z)\f$
+ */
+POLYLOGARITHM_INLINE std::vector<std::complex<double>> LiPlan::operator()(const std::vector<std::complex<double>>& z) const
+{
+   std::vector<std::complex<double>> out(z.size());
+   (*this)(z.data(), out.data(), z.size());
+   return out;
+}
+
+} // namespace polylogarithm
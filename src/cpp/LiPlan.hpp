@@ -0,0 +1,66 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace polylogarithm {
+
+/**
+ * Complex polylogarithm Li(n, z) for a fixed integer order n.
+ *
+ * For n >= 7 the constructor pre-computes the coefficients of the
+ * series expansions used by Li(int64_t, const std::complex<double>&),
+ * so that repeated evaluations at the same order do not need to look
+ * up zeta values, Dirichlet eta values, harmonic numbers and inverse
+ * factorials or to compute the series weights again.  For n < 7 the
+ * plan forwards to Li(n, z).
+ */
+class LiPlan {
+public:
+   explicit LiPlan(int64_t n);
+
+   /// returns the order n of the polylogarithm
+   int64_t order() const noexcept { return n; }
+
+   /// complex polylogarithm Li(n, z)
+   std::complex<double> operator()(const std::complex<double>&) const noexcept;
+
+   /// complex polylogarithm Li(n, z) for an array of complex numbers
+   void operator()(const std::complex<double>* z, std::complex<double>* out, std::size_t count) const noexcept;
+
+   /// complex polylogarithm Li(n, z) for a vector of complex numbers
+   std::vector<std::complex<double>> operator()(const std::vector<std::complex<double>>&) const;
+
+private:
+   int64_t n{};
+   double zeta_n{};                     ///< zeta(n)
+   double neg_eta_n{};                  ///< -eta(n)
+   double harmonic_n1{};                ///< harmonic(n - 1)
+   double inv_fac_n{};                  ///< 1/n!
+   std::vector<double> series_weights;  ///< k^n for k = 1, 2, ...
+   int64_t j_unity{};                   ///< zeta(n - j) = 1 for j = 1, ..., j_unity
+   std::vector<double> zeta_head;       ///< zeta(n - j) for j = j_unity + 1, ..., n - 2
+   std::vector<double> inv_j;           ///< 1/j for j = j_unity + 1, ..., n + 1
+   std::vector<double> zeta_tail;       ///< zeta(n - j) for j = n + 3, n + 5, ...
+   std::vector<double> inv_tail;        ///< 1/((j - 1)*j) for j = n + 3, n + 5, ...
+   std::vector<double> rest_coeffs;     ///< -eta(2k)/(n - 2k)! for k = kmax, ..., 1
+   bool rest_truncated{false};          ///< (n - 2k)! overflows for some k
+
+   std::complex<double> series(const std::complex<double>&) const noexcept;
+   std::complex<double> unity_pos(const std::complex<double>&) const noexcept;
+   std::complex<double> rest(const std::complex<double>&) const noexcept;
+};
+
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "LiPlan.cpp"
+#endif
@@ -0,0 +1,151 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "Li_all.hpp"
+#include "Li2.hpp"
+#include "Li3.hpp"
+#include "Li4.hpp"
+#include "Li5.hpp"
+#include "Li6.hpp"
+#include "complex.hpp"
+#include "li_coeffs.hpp"
+#include <cmath>
+
+namespace polylogarithm {
+
+namespace detail {
+namespace li_all {
+
+   /// sum of bf[k]*u^(k+1) for k = 0,...,17
+   template <int N>
+   Complex<double> bernoulli_series(
+      const Complex<double>& u, const Complex<double>& u2,
+      const Complex<double>& u4, const Complex<double>& u8,
+      const double (&bf)[N]) noexcept
+   {
+      static_assert(N >= 18, "at least 18 coefficients required");
+
+      return
+         u*bf[0] +
+         u2*(bf[1] + u*bf[2]) +
+         u4*(bf[3] + u*bf[4] + u2*(bf[5] + u*bf[6])) +
+         u8*(bf[7] + u*bf[8] + u2*(bf[9] + u*bf[10]) +
+             u4*(bf[11] + u*bf[12] + u2*(bf[13] + u*bf[14]))) +
+         u8*u8*(bf[15] + u*bf[16] + u2*bf[17]);
+   }
+
+} // namespace li_all
+} // namespace detail
+
+/**
+ * @brief Complex polylogarithms \f$\operatorname{Li}_n(z)\f$ for n = 2,...,6
+ * @param z_ complex argument
+ * @return array with \f$\operatorname{Li}_2(z),\ldots,\operatorname{Li}_6(z)\f$
+ * @author Alexander Voigt
+ *
+ * Shares the transformation of Li3(), ..., Li6() between all orders:
+ * \f$|z|\f$, \f$\arg(z)\f$ and \f$\log|z|\f$ are computed once, as
+ * well as either \f$\log(-\log(z))\f$ (for \f$|\log(z)| < 1\f$) or
+ * \f$u = -\log(1-z)\f$ resp. \f$u = -\log(1-1/z)\f$ together with
+ * its powers (otherwise).  The dilogarithm is evaluated on the same
+ * footing, using the expansion in terms of \f$\log(z)\f$ and the
+ * Bernoulli series in \f$u\f$, respectively.
+ */
+POLYLOGARITHM_INLINE std::array<std::complex<double>, 5> Li_all(const std::complex<double>& z_) noexcept
+{
+   const double PI    = 3.1415926535897932;
+   const double PI2   = PI*PI;
+   const double PI4   = PI2*PI2;
+   const double PI6   = PI2*PI4;
+   const double zeta2 = 1.6449340668482264;
+   const double zeta3 = 1.2020569031595943;
+   const double zeta4 = 1.0823232337111382;
+   const double zeta5 = 1.0369277551433699;
+   const double zeta6 = 1.0173430619844491;
+
+   const Complex<double> z = { std::real(z_), std::imag(z_) };
+
+   if (z.im == 0) {
+      return {{ Li2(z_), Li3(z_), Li4(z_), Li5(z_), Li6(z_) }};
+   }
+
+   const double nz  = norm(z);
+   const double pz  = arg(z);
+   const double lnz = std::log(nz);
+
+   if (lnz*lnz + pz*pz < 1) { // |log(z)| < 1
+      const Complex<double> u(lnz, pz); // log(z)
+      const Complex<double> u2 = u*u;
+      const Complex<double> lmu = log(-u);
+
+      const auto& cs2 = detail::li_coeffs::Tables<>::li2_cs;
+      const auto& cs3 = detail::li_coeffs::Tables<>::li3_cs;
+      const auto& cs4 = detail::li_coeffs::Tables<>::li4_cs;
+      const auto& cs5 = detail::li_coeffs::Tables<>::li5_cs;
+      const auto& cs6 = detail::li_coeffs::Tables<>::li6_cs;
+
+      const Complex<double> li2 = zeta2 + u*(1.0 - lmu) +
+         u2*(-0.25 + u*detail::li_coeffs::horner<0>(u2, cs2));
+
+      const Complex<double> li3 = zeta3 + u*(zeta2 - u2/12.0) +
+         u2*(0.25*(3.0 - 2.0*lmu) + u2*detail::li_coeffs::horner<0>(u2, cs3));
+
+      const Complex<double> li4 = zeta4 + u2*(0.82246703342411322 - u2/48.0) +
+         u*(zeta3 + u2*((11.0/6.0 - lmu)/6.0 + u2*detail::li_coeffs::horner<0>(u2, cs4)));
+
+      const Complex<double> li5 = zeta5 + u*zeta4 +
+         u2*(0.60102845157979714 + u*0.27415567780803774 +
+         u2*((25.0/12.0 - lmu)/24.0 - u/240.0 +
+         u2*detail::li_coeffs::horner<0>(u2, cs5)));
+
+      const Complex<double> li6 = zeta6 + u*zeta5 +
+         u2*(0.54116161685556910 + u*0.20034281719326571 +
+         u2*(0.068538919452009435 + u*((137.0/60.0 - lmu)/120.0) +
+         u2*(-1.0/1440.0 + u*detail::li_coeffs::horner<0>(u2, cs6))));
+
+      return {{ li2, li3, li4, li5, li6 }};
+   }
+
+   const auto& bf2 = detail::li_coeffs::Tables<>::li2_bf;
+   const auto& bf3 = detail::li_coeffs::Tables<>::li3_bf;
+   const auto& bf4 = detail::li_coeffs::Tables<>::li4_bf;
+   const auto& bf5 = detail::li_coeffs::Tables<>::li5_bf;
+   const auto& bf6 = detail::li_coeffs::Tables<>::li6_bf;
+
+   Complex<double> u(0.0, 0.0);
+   Complex<double> rest2(0.0, 0.0), rest3(0.0, 0.0), rest4(0.0, 0.0),
+      rest5(0.0, 0.0), rest6(0.0, 0.0);
+   double sgn = 1;
+
+   if (nz <= 1) {
+      u = -log(1.0 - z);
+   } else { // nz > 1
+      const double arg = pz > 0.0 ? pz - PI : pz + PI;
+      const Complex<double> lmz(lnz, arg); // log(-z)
+      const Complex<double> lmz2 = lmz*lmz;
+      u = -log(1.0 - 1.0/z);
+      rest2 = -0.5*lmz2 - PI2/6;
+      rest3 = -lmz*(lmz2/6.0 + zeta2);
+      rest4 = 1.0/360.0*(-7*PI4 + lmz2*(-30.0*PI2 - 15.0*lmz2));
+      rest5 = -1.0/360.0*lmz*(7*PI4 + lmz2*(10.0*PI2 + 3.0*lmz2));
+      rest6 = -31.0*PI6/15120.0 + lmz2*(-7.0/720.0*PI4 + lmz2*(-1.0/144.0*PI2 - 1.0/720.0*lmz2));
+      sgn = -1;
+   }
+
+   const Complex<double> u2 = u*u;
+   const Complex<double> u4 = u2*u2;
+   const Complex<double> u8 = u4*u4;
+
+   return {{
+      rest2 + sgn*(u + u2*(bf2[0] + u*detail::li_coeffs::horner<1>(u2, bf2))),
+      rest3 + detail::li_all::bernoulli_series(u, u2, u4, u8, bf3),
+      rest4 + sgn*detail::li_all::bernoulli_series(u, u2, u4, u8, bf4),
+      rest5 + detail::li_all::bernoulli_series(u, u2, u4, u8, bf5) + u8*u8*u2*u*bf5[18],
+      rest6 + sgn*detail::li_all::bernoulli_series(u, u2, u4, u8, bf6)
+   }};
+}
+
+} // namespace polylogarithm
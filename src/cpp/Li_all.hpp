@@ -0,0 +1,21 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <array>
+#include <complex>
+
+namespace polylogarithm {
+
+/// complex polylogarithms with n=2,...,6, element i contains Li_{i+2}
+std::array<std::complex<double>, 5> Li_all(const std::complex<double>&) noexcept;
+
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li_all.cpp"
+#endif
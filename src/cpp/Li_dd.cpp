@@ -0,0 +1,191 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "Li_dd.hpp"
+#include "DoubleDouble.hpp"
+#include "complex.hpp"
+#include "li_kernel.hpp"
+#include <cmath>
+
+/**
+ * The polylogarithms are the type-generic kernels of li_kernel.hpp,
+ * which also implement the long double variants of Li2.cpp, ...,
+ * Li6.cpp, evaluated on Complex<DoubleDouble>.
+ */
+
+namespace polylogarithm {
+
+namespace detail {
+namespace li_kernel {
+
+   template <>
+   struct Real<DoubleDouble> {
+      static constexpr int digits = 106;
+      static DoubleDouble eps() noexcept { return detail::dd::eps; }
+      static DoubleDouble log(const DoubleDouble& x) noexcept { return polylogarithm::log(x); }
+      static DoubleDouble log1p(const DoubleDouble& x) noexcept { return polylogarithm::log1p(x); }
+      static DoubleDouble atan2(const DoubleDouble& y, const DoubleDouble& x) noexcept { return polylogarithm::atan2(y, x); }
+      static DoubleDouble hypot(const DoubleDouble& x, const DoubleDouble& y) noexcept { return polylogarithm::hypot(x, y); }
+   };
+
+} // namespace li_kernel
+
+namespace li_dd {
+
+   /// returns e^(ix) for x reduced to [0,pi], sgn = -1 if x -> -x was applied
+   POLYLOGARITHM_INLINE Complex<DoubleDouble> expi(const DoubleDouble& x, double& sgn) noexcept
+   {
+      DoubleDouble r = x - detail::dd::pi2*std::round((x/detail::dd::pi2).hi);
+
+      sgn = 1;
+
+      if (r < 0) {
+         r = -r;
+         sgn = -1;
+      }
+
+      DoubleDouble s, c;
+      sincos(r, s, c);
+
+      return { c, s };
+   }
+
+} // namespace li_dd
+} // namespace detail
+
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ with double-double precision
+ * @param x real argument
+ * @return \f$\operatorname{Li}_2(x)\f$
+ *
+ * The argument is mapped to \f$y \in [0,1/2]\f$, where the series in
+ * \f$u = -\log(1-y)\f$ with Bernoulli coefficients is summed.
+ */
+POLYLOGARITHM_INLINE DoubleDouble Li2(const DoubleDouble& x) noexcept
+{
+   return detail::li_kernel::li2(x);
+}
+
+/**
+ * @brief Complex dilogarithm \f$\operatorname{Li}_2(z)\f$ with double-double precision
+ * @param z complex argument
+ * @return \f$\operatorname{Li}_2(z)\f$
+ */
+POLYLOGARITHM_INLINE Complex<DoubleDouble> Li2(const Complex<DoubleDouble>& z) noexcept
+{
+   // special cases
+   if (z.im == 0) {
+      if (z.re <= 1) {
+         return Li2(z.re);
+      }
+      // z.re > 1
+      return { Li2(z.re), -detail::dd::pi*log(z.re) };
+   }
+
+   return detail::li_kernel::li2(z);
+}
+
+/**
+ * @brief Complex trilogarithm \f$\operatorname{Li}_3(z)\f$ with double-double precision
+ * @param z complex argument
+ * @return \f$\operatorname{Li}_3(z)\f$
+ */
+POLYLOGARITHM_INLINE Complex<DoubleDouble> Li3(const Complex<DoubleDouble>& z) noexcept
+{
+   return detail::li_kernel::li3(z);
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_4(z)\f$ with double-double precision
+ * @param z complex argument
+ * @return \f$\operatorname{Li}_4(z)\f$
+ */
+POLYLOGARITHM_INLINE Complex<DoubleDouble> Li4(const Complex<DoubleDouble>& z) noexcept
+{
+   return detail::li_kernel::li4(z);
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_5(z)\f$ with double-double precision
+ * @param z complex argument
+ * @return \f$\operatorname{Li}_5(z)\f$
+ */
+POLYLOGARITHM_INLINE Complex<DoubleDouble> Li5(const Complex<DoubleDouble>& z) noexcept
+{
+   return detail::li_kernel::li5(z);
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_6(z)\f$ with double-double precision
+ * @param z complex argument
+ * @return \f$\operatorname{Li}_6(z)\f$
+ */
+POLYLOGARITHM_INLINE Complex<DoubleDouble> Li6(const Complex<DoubleDouble>& z) noexcept
+{
+   return detail::li_kernel::li6(z);
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_2(\theta) = \operatorname{Im}(\operatorname{Li}_2(e^{i\theta}))\f$ with double-double precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_2(\theta)\f$
+ */
+POLYLOGARITHM_INLINE DoubleDouble Cl2(const DoubleDouble& x) noexcept
+{
+   double sgn = 1;
+   const Complex<DoubleDouble> z = detail::li_dd::expi(x, sgn);
+   return sgn*Li2(z).im;
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_3(\theta) = \operatorname{Re}(\operatorname{Li}_3(e^{i\theta}))\f$ with double-double precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_3(\theta)\f$
+ */
+POLYLOGARITHM_INLINE DoubleDouble Cl3(const DoubleDouble& x) noexcept
+{
+   double sgn = 1;
+   const Complex<DoubleDouble> z = detail::li_dd::expi(x, sgn);
+   return Li3(z).re;
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_4(\theta) = \operatorname{Im}(\operatorname{Li}_4(e^{i\theta}))\f$ with double-double precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_4(\theta)\f$
+ */
+POLYLOGARITHM_INLINE DoubleDouble Cl4(const DoubleDouble& x) noexcept
+{
+   double sgn = 1;
+   const Complex<DoubleDouble> z = detail::li_dd::expi(x, sgn);
+   return sgn*Li4(z).im;
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_5(\theta) = \operatorname{Re}(\operatorname{Li}_5(e^{i\theta}))\f$ with double-double precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_5(\theta)\f$
+ */
+POLYLOGARITHM_INLINE DoubleDouble Cl5(const DoubleDouble& x) noexcept
+{
+   double sgn = 1;
+   const Complex<DoubleDouble> z = detail::li_dd::expi(x, sgn);
+   return Li5(z).re;
+}
+
+/**
+ * @brief Clausen function \f$\operatorname{Cl}_6(\theta) = \operatorname{Im}(\operatorname{Li}_6(e^{i\theta}))\f$ with double-double precision
+ * @param x real angle
+ * @return \f$\operatorname{Cl}_6(\theta)\f$
+ */
+POLYLOGARITHM_INLINE DoubleDouble Cl6(const DoubleDouble& x) noexcept
+{
+   double sgn = 1;
+   const Complex<DoubleDouble> z = detail::li_dd::expi(x, sgn);
+   return sgn*Li6(z).im;
+}
+
+} // namespace polylogarithm
@@ -0,0 +1,51 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include "DoubleDouble.hpp"
+#include "complex.hpp"
+
+namespace polylogarithm {
+
+/// real polylogarithm with n=2 (dilogarithm) with double-double precision
+DoubleDouble Li2(const DoubleDouble&) noexcept;
+
+/// complex polylogarithm with n=2 (dilogarithm) with double-double precision
+Complex<DoubleDouble> Li2(const Complex<DoubleDouble>&) noexcept;
+
+/// complex polylogarithm with n=3 (trilogarithm) with double-double precision
+Complex<DoubleDouble> Li3(const Complex<DoubleDouble>&) noexcept;
+
+/// complex polylogarithm with n=4 with double-double precision
+Complex<DoubleDouble> Li4(const Complex<DoubleDouble>&) noexcept;
+
+/// complex polylogarithm with n=5 with double-double precision
+Complex<DoubleDouble> Li5(const Complex<DoubleDouble>&) noexcept;
+
+/// complex polylogarithm with n=6 with double-double precision
+Complex<DoubleDouble> Li6(const Complex<DoubleDouble>&) noexcept;
+
+/// Clausen function with n=2 with double-double precision
+DoubleDouble Cl2(const DoubleDouble&) noexcept;
+
+/// Clausen function with n=3 with double-double precision
+DoubleDouble Cl3(const DoubleDouble&) noexcept;
+
+/// Clausen function with n=4 with double-double precision
+DoubleDouble Cl4(const DoubleDouble&) noexcept;
+
+/// Clausen function with n=5 with double-double precision
+DoubleDouble Cl5(const DoubleDouble&) noexcept;
+
+/// Clausen function with n=6 with double-double precision
+DoubleDouble Cl6(const DoubleDouble&) noexcept;
+
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li_dd.cpp"
+#endif
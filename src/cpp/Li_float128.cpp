@@ -0,0 +1,128 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "Li_float128.hpp"
+
+#ifdef ENABLE_FLOAT128
+
+#include "complex.hpp"
+#include "li_kernel.hpp"
+#include <cmath>
+#include <quadmath.h>
+
+/**
+ * The polylogarithms are the type-generic kernels of li_kernel.hpp,
+ * which also implement the long double and DoubleDouble variants,
+ * evaluated with the __float128 type.  The elementary functions are
+ * taken from libquadmath, because the overloads of std::log etc. may
+ * convert __float128 to long double.
+ */
+
+namespace polylogarithm {
+
+namespace detail {
+namespace li_kernel {
+
+   template <>
+   struct Real<__float128> {
+      static constexpr int digits = 113;
+      static __float128 eps() noexcept { return std::ldexp(1.0, -112); }
+      static __float128 log(__float128 x) noexcept { return logq(x); }
+      static __float128 log1p(__float128 x) noexcept { return log1pq(x); }
+      static __float128 atan2(__float128 y, __float128 x) noexcept { return atan2q(y, x); }
+      static __float128 hypot(__float128 x, __float128 y) noexcept { return hypotq(x, y); }
+   };
+
+} // namespace li_kernel
+
+namespace li_float128 {
+
+   inline Complex<__float128> to_complex(const std::complex<__float128>& z) noexcept
+   {
+      return { std::real(z), std::imag(z) };
+   }
+
+} // namespace li_float128
+} // namespace detail
+
+/**
+ * @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ with quadruple precision
+ * @param x real argument
+ * @return \f$\operatorname{Li}_2(x)\f$
+ *
+ * The argument is mapped to \f$y \in [0,1/2]\f$, where the series in
+ * \f$u = -\log(1-y)\f$ with Bernoulli coefficients is summed.
+ */
+POLYLOGARITHM_INLINE __float128 Li2(__float128 x) noexcept
+{
+   return detail::li_kernel::li2(x);
+}
+
+/**
+ * @brief Complex dilogarithm \f$\operatorname{Li}_2(z)\f$ with quadruple precision
+ * @param z_ complex argument
+ * @return \f$\operatorname{Li}_2(z)\f$
+ */
+POLYLOGARITHM_INLINE std::complex<__float128> Li2(const std::complex<__float128>& z_) noexcept
+{
+   static const __float128 PI = detail::li_kernel::to<__float128>(detail::li_kernel::constants::pi);
+   const Complex<__float128> z = detail::li_float128::to_complex(z_);
+
+   // special cases
+   if (z.im == 0) {
+      if (z.re <= 1) {
+         return Li2(z.re);
+      }
+      // z.re > 1
+      return { Li2(z.re), -PI*logq(z.re) };
+   }
+
+   return detail::li_kernel::li2(z);
+}
+
+/**
+ * @brief Complex trilogarithm \f$\operatorname{Li}_3(z)\f$ with quadruple precision
+ * @param z_ complex argument
+ * @return \f$\operatorname{Li}_3(z)\f$
+ */
+POLYLOGARITHM_INLINE std::complex<__float128> Li3(const std::complex<__float128>& z_) noexcept
+{
+   return detail::li_kernel::li3(detail::li_float128::to_complex(z_));
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_4(z)\f$ with quadruple precision
+ * @param z_ complex argument
+ * @return \f$\operatorname{Li}_4(z)\f$
+ */
+POLYLOGARITHM_INLINE std::complex<__float128> Li4(const std::complex<__float128>& z_) noexcept
+{
+   return detail::li_kernel::li4(detail::li_float128::to_complex(z_));
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_5(z)\f$ with quadruple precision
+ * @param z_ complex argument
+ * @return \f$\operatorname{Li}_5(z)\f$
+ */
+POLYLOGARITHM_INLINE std::complex<__float128> Li5(const std::complex<__float128>& z_) noexcept
+{
+   return detail::li_kernel::li5(detail::li_float128::to_complex(z_));
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_6(z)\f$ with quadruple precision
+ * @param z_ complex argument
+ * @return \f$\operatorname{Li}_6(z)\f$
+ */
+POLYLOGARITHM_INLINE std::complex<__float128> Li6(const std::complex<__float128>& z_) noexcept
+{
+   return detail::li_kernel::li6(detail::li_float128::to_complex(z_));
+}
+
+} // namespace polylogarithm
+
+#endif // ENABLE_FLOAT128
@@ -0,0 +1,44 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+
+/**
+ * ENABLE_FLOAT128 is defined by the build system if the compiler
+ * supports the __float128 type and libquadmath is available.
+ */
+#ifdef ENABLE_FLOAT128
+
+#include <complex>
+
+namespace polylogarithm {
+
+/// real polylogarithm with n=2 (dilogarithm) with quadruple precision
+__float128 Li2(__float128) noexcept;
+
+/// complex polylogarithm with n=2 (dilogarithm) with quadruple precision
+std::complex<__float128> Li2(const std::complex<__float128>&) noexcept;
+
+/// complex polylogarithm with n=3 (trilogarithm) with quadruple precision
+std::complex<__float128> Li3(const std::complex<__float128>&) noexcept;
+
+/// complex polylogarithm with n=4 with quadruple precision
+std::complex<__float128> Li4(const std::complex<__float128>&) noexcept;
+
+/// complex polylogarithm with n=5 with quadruple precision
+std::complex<__float128> Li5(const std::complex<__float128>&) noexcept;
+
+/// complex polylogarithm with n=6 with quadruple precision
+std::complex<__float128> Li6(const std::complex<__float128>&) noexcept;
+
+} // namespace polylogarithm
+
+#endif // ENABLE_FLOAT128
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Li_float128.cpp"
+#endif
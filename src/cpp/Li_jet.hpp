@@ -0,0 +1,175 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "Li.hpp"
+#include "Li_all.hpp"
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+
+namespace polylogarithm {
+
+/// dual number val + der*e with e^2 = 0
+template <typename T>
+struct Dual {
+   T val; ///< value
+   T der; ///< derivative part
+};
+
+namespace detail {
+
+/// Li_n(z) for integer n, using the specialized kernels for n = 2,...,6
+inline std::complex<double> li_n(int64_t n, const std::complex<double>& z) noexcept
+{
+   switch (n) {
+   case 2: return Li2(z);
+   case 3: return Li3(z);
+   case 4: return Li4(z);
+   case 5: return Li5(z);
+   case 6: return Li6(z);
+   default: break;
+   }
+   return Li(n, z);
+}
+
+/**
+ * Returns Li_{N-j}(z) for j = 0,...,Order.  If at least two of the
+ * orders lie in [2,6], they are taken from Li_all(z), which shares
+ * the transformation of z between the orders.
+ */
+template <int64_t N, int Order>
+std::array<std::complex<double>, Order + 1> li_orders(const std::complex<double>& z) noexcept
+{
+   const int64_t lo = N - Order < 2 ? 2 : N - Order;
+   const int64_t hi = N > 6 ? 6 : N;
+   const bool shared = hi > lo;
+
+   std::array<std::complex<double>, 5> all{};
+   if (shared) {
+      all = Li_all(z);
+   }
+
+   std::array<std::complex<double>, Order + 1> li{};
+
+   for (int j = 0; j <= Order; ++j) {
+      const int64_t n = N - j;
+      li[j] = shared && n >= lo && n <= hi ? all[n - 2] : li_n(n, z);
+   }
+
+   return li;
+}
+
+/**
+ * Derivatives of Li_N(z) from the term-wise differentiated series
+ *
+ * d^k/dz^k Li_N(z) = sum_{m >= k} m!/(m-k)! z^(m-k)/m^N
+ *
+ * for |z| < 1/2, where the relation to Li_{N-1},...,Li_{N-k} suffers
+ * from cancellations.
+ */
+template <int64_t N, int Order>
+std::array<std::complex<double>, Order + 1> li_jet_series(const std::complex<double>& z) noexcept
+{
+   const double eps = std::numeric_limits<double>::epsilon();
+
+   std::array<std::complex<double>, Order + 1> jet{};
+   std::complex<double> zp[Order + 1] = { 1.0 }; // zp[k] = z^(m-k)
+
+   for (int64_t m = 1; ; ++m) {
+      const double w = std::pow(static_cast<double>(m), static_cast<double>(-N));
+      double fac = 1; // m!/(m-k)!
+      bool converged = m > Order;
+
+      for (int k = 0; k <= Order && k <= m; ++k) {
+         zp[k] = k == m ? std::complex<double>(1.0, 0.0) : zp[k]*z;
+         const std::complex<double> term = fac*w*zp[k];
+         jet[k] += term;
+         if (std::abs(term) > eps*std::abs(jet[k])) {
+            converged = false;
+         }
+         fac *= static_cast<double>(m - k);
+      }
+
+      if (converged) {
+         break;
+      }
+   }
+
+   return jet;
+}
+
+} // namespace detail
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_N(z)\f$ and its derivatives
+ * @tparam N order of the polylogarithm
+ * @tparam Order highest derivative
+ * @param z complex argument
+ * @return array with \f$d^k/dz^k \operatorname{Li}_N(z)\f$ for \f$k = 0,\ldots,\f$ Order
+ *
+ * The derivatives are obtained from
+ * \f[
+ *   z^k \frac{d^k}{dz^k} \operatorname{Li}_N(z)
+ *   = \sum_{j=1}^k s(k,j) \operatorname{Li}_{N-j}(z),
+ * \f]
+ * where \f$s(k,j)\f$ are the signed Stirling numbers of the first
+ * kind, so that all orders are computed from one call of Li_all()
+ * where possible.  For \f$|z| < 1/2\f$ the derivatives are summed
+ * from the power series instead.
+ */
+template <int64_t N, int Order>
+std::array<std::complex<double>, Order + 1> Li_jet(const std::complex<double>& z) noexcept
+{
+   static_assert(Order >= 0, "the order of the jet must not be negative");
+
+   if (std::norm(z) < 0.25) {
+      return detail::li_jet_series<N, Order>(z);
+   }
+
+   const auto li = detail::li_orders<N, Order>(z);
+
+   std::array<std::complex<double>, Order + 1> jet{};
+   jet[0] = li[0];
+
+   double s[Order + 1] = { 1 }; // s(k,j) for j = 0,...,k
+   std::complex<double> zk(1.0, 0.0);
+
+   for (int k = 1; k <= Order; ++k) {
+      // s(k,j) = s(k-1,j-1) - (k-1) s(k-1,j)
+      for (int j = k; j >= 1; --j) {
+         s[j] = s[j - 1] - (k - 1)*s[j];
+      }
+      s[0] = 0;
+
+      std::complex<double> sum(0.0, 0.0);
+      for (int j = 1; j <= k; ++j) {
+         sum += s[j]*li[j];
+      }
+
+      zk *= z;
+      jet[k] = sum/zk;
+   }
+
+   return jet;
+}
+
+/**
+ * @brief Complex polylogarithm \f$\operatorname{Li}_N(z)\f$ of a dual number
+ * @tparam N order of the polylogarithm
+ * @param z dual number \f$z_0 + z_1 e\f$
+ * @return \f$\operatorname{Li}_N(z_0) + z_1 \operatorname{Li}_N'(z_0) e\f$
+ */
+template <int64_t N>
+Dual<std::complex<double>> Li(const Dual<std::complex<double>>& z) noexcept
+{
+   const auto jet = Li_jet<N, 1>(z.val);
+   return { jet[0], jet[1]*z.der };
+}
+
+} // namespace polylogarithm
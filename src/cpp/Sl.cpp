@@ -5,15 +5,20 @@
 // ====================================================================
 
 #include "Sl.hpp"
+#include "inv_pow.hpp"
+#include "trig_sum.hpp"
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace polylogarithm {
 
-namespace {
+namespace detail {
+namespace sl {
 
 constexpr double PI = 3.14159265358979324;
 constexpr double PI2 = PI*PI;
+constexpr int64_t N_THRESH = 25; // threshold to switch to the series
 
 constexpr bool is_even(int64_t n) noexcept
 {
@@ -21,7 +26,7 @@ constexpr bool is_even(int64_t n) noexcept
 }
 
 // range-reduces x in [0,pi] for even n
-void range_reduce_even(double& x) noexcept
+POLYLOGARITHM_INLINE void range_reduce_even(double& x) noexcept
 {
    if (x < 0) {
       x = -x;
@@ -39,7 +44,7 @@ void range_reduce_even(double& x) noexcept
 }
 
 // range-reduces x in [0,pi] for odd n, retuns sign
-double range_reduce_odd(double& x) noexcept
+POLYLOGARITHM_INLINE double range_reduce_odd(double& x) noexcept
 {
    double sgn = 1.0;
 
@@ -63,7 +68,7 @@ double range_reduce_odd(double& x) noexcept
 }
 
 // range-reduces x to be in [0,pi], returns sign
-double range_reduce(int64_t n, double& x) noexcept
+POLYLOGARITHM_INLINE double range_reduce(int64_t n, double& x) noexcept
 {
    double sgn = 1.0;
 
@@ -77,40 +82,15 @@ double range_reduce(int64_t n, double& x) noexcept
 }
 
 // returns Sl(n,x) using the naive series expansion
-double sl_series(int64_t n, double x) noexcept
+POLYLOGARITHM_INLINE double sl_series(int64_t n, double x)
 {
-   const auto eps = std::numeric_limits<double>::epsilon();
-   const auto kmax = static_cast<int64_t>(std::ceil(std::pow(eps, -1.0/n)));
-   const double co = std::cos(x);
-   double sum = 0;
+   const bool sine = !is_even(n);
 
-   if (is_even(n)) {
-      double co2 = 1;  // cos((n-2)*x)
-      double co1 = co; // cos((n-1)*x)
-      sum = co;
-      for (int64_t k = 2; k <= kmax; ++k) {
-         const double con = 2*co*co1 - co2; // cos(n*x)
-         co2 = co1;
-         co1 = con;
-         sum += con*std::pow(k, -n);
-      }
-   } else {
-      double si = std::sin(x);
-      double si2 = 0;  // sin((n-2)*x)
-      double si1 = si; // sin((n-1)*x)
-      sum = si;
-      for (int64_t k = 2; k <= kmax; ++k) {
-         si = 2*co*si1 - si2; // sin(n*x)
-         si2 = si1;
-         si1 = si;
-         sum += si*std::pow(k, -n);
-      }
-   }
-
-   return sum;
+   return trig::trig_sum(*inv_pow(n), sine, std::cos(x), sine ? std::sin(x) : 0);
 }
 
-} // anonymous namespace
+} // namespace sl
+} // namespace detail
 
 /**
  * @brief Glaisher-Clausen function \f$\operatorname{Sl}_n(x)\f$ for \f$n>0\f$
@@ -122,18 +102,18 @@ double sl_series(int64_t n, double x) noexcept
  * Note: We set \f$\operatorname{Sl}_1(0)=0\f$ for consistency with
  * the series expansion.
  */
-double Sl(int64_t n, double x)
+POLYLOGARITHM_INLINE double Sl(int64_t n, double x)
 {
    if (n < 1) {
       return std::numeric_limits<double>::quiet_NaN();
    }
 
-   const auto sgn = range_reduce(n, x);
+   const auto sgn = detail::sl::range_reduce(n, x);
 
    if (n ==  1 && x == 0) { return 0; }
-   if (n ==  1) { return sgn*(PI/2 - 1./2*x); }
-   if (n ==  2) { return sgn*(PI2/6 + (-1./2*PI + 1./4*x)*x); }
-   if (n ==  3) { return sgn*(x*(PI2/6 + (-1./4*PI + 1./12*x)*x)); }
+   if (n ==  1) { return sgn*(detail::sl::PI/2 - 1./2*x); }
+   if (n ==  2) { return sgn*(detail::sl::PI2/6 + (-1./2*detail::sl::PI + 1./4*x)*x); }
+   if (n ==  3) { return sgn*(x*(detail::sl::PI2/6 + (-1./4*detail::sl::PI + 1./12*x)*x)); }
 
    const double x2 = x*x;
 
@@ -160,7 +140,50 @@ double Sl(int64_t n, double x)
    if (n == 24) { return sgn*(1.00000005960818905125947961244022532705 + x2*(-0.50000011922525136386649500182398100405 + x2*(0.04166670641508474469983804800148527986 + x2*(-0.00138889419068509027755535619670689634 + x2*(0.00002480196632587819077062828798332432 + x2*(-2.7559007058395577183345969607174e-7 + x2*(2.08818944770394931519777386557e-9 + x2*(-1.148215411599875549450028632e-11 + x2*(4.79896496391152948033985073926223650869004394e-14 + x2*(-1.589009184319035733475811106833666904671266e-16 + x2*(4.448692261643102279055457698828666914377e-19 + (-1.4634635247084016879459654064567869849e-21 + (6.0761074954442669805583461967607548e-23 - 8.058687855480591745243566524005859e-25*x)*x)*x2))))))))))); }
    if (n == 25) { return sgn*(x*(1.00000005960818905125947961244022532705 + x2*(-0.16666670640841712128883166727466033468 + x2*(0.00833334128301694893996760960029705597 + x2*(-0.00019841345581215575393647945667241376 + x2*(2.75577403620868786340314310925826e-6 + x2*(-2.505364278035961562122360873379e-8 + x2*(1.6062995751568840886136722043e-10 + x2*(-7.654769410665836996333524210366101004611481858e-13 + x2*(2.822920567006782047258735728977786181582112e-15 + x2*(-8.3632062332580828077674268780719310772978e-18 + x2*(2.11842488649671537097878938039460329257e-20 + (-6.3628848900365290780259365498121174e-23 + (2.5317114564351112418993109153169811e-24 - 3.22347514219223669809742660960235e-26*x)*x)*x2)))))))))))); }
 
-   return sgn*sl_series(n, x);
+   return sgn*detail::sl::sl_series(n, x);
+}
+
+/**
+ * @brief Glaisher-Clausen function \f$\operatorname{Sl}_n(x)\f$ on a uniform grid
+ * @param n degree of Glaisher-Clausen function
+ * @param x0 first angle
+ * @param h grid spacing
+ * @param count number of grid points
+ * @param out array of size count, filled with \f$\operatorname{Sl}_n(x_0 + k h)\f$
+ * @author Alexander Voigt
+ *
+ * For \f$n > 25\f$, where Sl(int64_t, double) sums the series
+ * expansion, the weights \f$k^{-n}\f$ are computed once for the whole
+ * grid and \f$\cos(x)\f$ and \f$\sin(x)\f$ are obtained from the
+ * previous grid point by the angle-addition theorem.  For
+ * \f$n \leq 25\f$ Sl(int64_t, double) is called for each grid point.
+ */
+POLYLOGARITHM_INLINE void Sl_grid(int64_t n, double x0, double h, std::size_t count, double* out)
+{
+   if (n <= detail::sl::N_THRESH) {
+      for (std::size_t j = 0; j < count; ++j) {
+         out[j] = Sl(n, x0 + j*h);
+      }
+      return;
+   }
+
+   detail::trig::series_grid(n, !detail::sl::is_even(n), x0, h, count, out);
+}
+
+/**
+ * @brief Glaisher-Clausen function \f$\operatorname{Sl}_n(x)\f$ on a uniform grid
+ * @param n degree of Glaisher-Clausen function
+ * @param x0 first angle
+ * @param h grid spacing
+ * @param count number of grid points
+ * @return vector of \f$\operatorname{Sl}_n(x_0 + k h)\f$ for \f$k = 0, \ldots, \text{count} - 1\f$
+ * @author Alexander Voigt
+ */
+POLYLOGARITHM_INLINE std::vector<double> Sl_grid(int64_t n, double x0, double h, std::size_t count)
+{
+   std::vector<double> out(count);
+   Sl_grid(n, x0, h, count, out.data());
+   return out;
 }
 
 } // namespace polylogarithm
@@ -5,11 +5,24 @@
 // ====================================================================
 
 #pragma once
+#include "config.hpp"
+#include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace polylogarithm {
 
 /// Glaisher-Clausen function for arbitrary integer n
 double Sl(int64_t, double);
 
+/// Glaisher-Clausen function for arbitrary integer n on the grid x0 + k*h, k = 0, ..., count - 1
+void Sl_grid(int64_t n, double x0, double h, std::size_t count, double* out);
+
+/// Glaisher-Clausen function for arbitrary integer n on the grid x0 + k*h, k = 0, ..., count - 1
+std::vector<double> Sl_grid(int64_t n, double x0, double h, std::size_t count);
+
 } // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "Sl.cpp"
+#endif
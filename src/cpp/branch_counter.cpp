@@ -0,0 +1,272 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "branch_counter.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <iomanip>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace polylogarithm {
+
+namespace detail {
+namespace branch_counter {
+
+   constexpr std::size_t N = static_cast<std::size_t>(Branch::NUMBER_OF_BRANCHES);
+
+   /// descriptions in the order of the enumerators of Branch,
+   /// the part before the colon names the group
+   const char* const names[] = {
+      "Li2(x): x < -1",
+      "Li2(x): x = -1",
+      "Li2(x): -1 < x < 0",
+      "Li2(x): x = 0",
+      "Li2(x): 0 < x < 1/2",
+      "Li2(x): 1/2 <= x < 1",
+      "Li2(x): x = 1",
+      "Li2(x): 1 < x < 2",
+      "Li2(x): x >= 2",
+      "Li2(z): Im(z) = 0",
+      "Li2(z): |z|^2 < eps",
+      "Li2(z): Re(z) <= 1/2, |z| > 1",
+      "Li2(z): Re(z) <= 1/2, |z| <= 1",
+      "Li2(z): Re(z) > 1/2, |z|^2 <= 2 Re(z)",
+      "Li2(z): Re(z) > 1/2, |z|^2 > 2 Re(z)",
+      "Li3(x): x < -1",
+      "Li3(x): x = -1",
+      "Li3(x): -1 < x < 0",
+      "Li3(x): x = 0",
+      "Li3(x): 0 < x < 1/2",
+      "Li3(x): x = 1/2",
+      "Li3(x): 1/2 < x < 1",
+      "Li3(x): x = 1",
+      "Li3(x): 1 < x < 2",
+      "Li3(x): x >= 2",
+      "Li3(z): Im(z) = 0",
+      "Li3(z): |log(z)| < 1",
+      "Li3(z): |z| <= 1",
+      "Li3(z): |z| > 1",
+      "Li4(x): x < -1",
+      "Li4(x): x = -1",
+      "Li4(x): -1 < x < 1",
+      "Li4(x): x = 1",
+      "Li4(x): x > 1",
+      "Li4(x) approximation: [-1, 0)",
+      "Li4(x) approximation: [0, 1/2)",
+      "Li4(x) approximation: [1/2, 4/5)",
+      "Li4(x) approximation: [4/5, 1]",
+      "Li4(z): Im(z) = 0",
+      "Li4(z): |log(z)| < 1",
+      "Li4(z): |z| <= 1",
+      "Li4(z): |z| > 1",
+      "Li5(z): z = 0, 1, -1",
+      "Li5(z): |log(z)| < 1",
+      "Li5(z): |z| <= 1",
+      "Li5(z): |z| > 1",
+      "Li6(z): z = 0, 1, -1",
+      "Li6(z): |log(z)| < 1",
+      "Li6(z): |z| <= 1",
+      "Li6(z): |z| > 1",
+      "Li(n,z): special values",
+      "Li(n,z): n < -1, series",
+      "Li(n,z): n < -1, expansion around z = 1",
+      "Li(n,z): n < -1, inversion",
+      "Li(n,z): -1 <= n <= 1, closed form",
+      "Li(n,z): 2 <= n <= 6, Li2, ..., Li6",
+      "Li(n,z): n > 6, series",
+      "Li(n,z): n > 6, inversion",
+      "Li(n,z): n > 6, expansion around z = 1"
+   };
+
+   static_assert(sizeof(names)/sizeof(names[0]) == N, "one name per branch required");
+
+   /**
+    * Counters of one thread.  The counters are only incremented by
+    * the owning thread, so a relaxed load and store suffices and no
+    * atomic read-modify-write is needed.  Other threads read them when
+    * the counts are summed.
+    */
+   struct ThreadCounters {
+      std::array<std::atomic<uint64_t>, N> counts;
+
+      ThreadCounters() noexcept;
+      ~ThreadCounters();
+   };
+
+   /// counters of all running threads and the sums of finished threads
+   struct Registry {
+      std::mutex mutex;
+      std::vector<ThreadCounters*> threads;
+      std::array<uint64_t, N> finished{};
+   };
+
+   POLYLOGARITHM_INLINE Registry& registry() noexcept
+   {
+      static Registry r;
+      return r;
+   }
+
+   POLYLOGARITHM_INLINE ThreadCounters::ThreadCounters() noexcept
+   {
+      for (auto& c: counts) {
+         c.store(0, std::memory_order_relaxed);
+      }
+
+      Registry& r = registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+      r.threads.push_back(this);
+   }
+
+   POLYLOGARITHM_INLINE ThreadCounters::~ThreadCounters()
+   {
+      Registry& r = registry();
+      std::lock_guard<std::mutex> lock(r.mutex);
+
+      for (std::size_t i = 0; i < N; ++i) {
+         r.finished[i] += counts[i].load(std::memory_order_relaxed);
+      }
+
+      r.threads.erase(std::remove(r.threads.begin(), r.threads.end(), this), r.threads.end());
+   }
+
+   POLYLOGARITHM_INLINE ThreadCounters& local() noexcept
+   {
+      thread_local ThreadCounters counters;
+      return counters;
+   }
+
+   POLYLOGARITHM_INLINE std::size_t index(Branch b) noexcept
+   {
+      return static_cast<std::size_t>(b);
+   }
+
+   /// returns the group of the branch, i.e. the name up to the colon
+   POLYLOGARITHM_INLINE std::string group(std::size_t i)
+   {
+      const std::string name(names[i]);
+      return name.substr(0, name.find(':'));
+   }
+
+} // namespace branch_counter
+
+POLYLOGARITHM_INLINE void count_branch(Branch b) noexcept
+{
+   auto& c = branch_counter::local().counts[branch_counter::index(b)];
+   c.store(c.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+}
+
+} // namespace detail
+
+POLYLOGARITHM_INLINE bool branch_counters_enabled() noexcept
+{
+#ifdef POLYLOGARITHM_BRANCH_COUNTERS
+   return true;
+#else
+   return false;
+#endif
+}
+
+POLYLOGARITHM_INLINE const char* branch_name(Branch b) noexcept
+{
+   const std::size_t i = detail::branch_counter::index(b);
+   return i < detail::branch_counter::N ? detail::branch_counter::names[i] : "";
+}
+
+POLYLOGARITHM_INLINE uint64_t branch_count(Branch b) noexcept
+{
+   using namespace detail::branch_counter;
+
+   const std::size_t i = index(b);
+
+   if (i >= N) {
+      return 0;
+   }
+
+   Registry& r = registry();
+   std::lock_guard<std::mutex> lock(r.mutex);
+   uint64_t sum = r.finished[i];
+
+   for (const auto* t: r.threads) {
+      sum += t->counts[i].load(std::memory_order_relaxed);
+   }
+
+   return sum;
+}
+
+POLYLOGARITHM_INLINE uint64_t thread_branch_count(Branch b) noexcept
+{
+   using namespace detail::branch_counter;
+
+   const std::size_t i = index(b);
+
+   return i < N ? local().counts[i].load(std::memory_order_relaxed) : 0;
+}
+
+POLYLOGARITHM_INLINE void reset_branch_counts() noexcept
+{
+   using namespace detail::branch_counter;
+
+   Registry& r = registry();
+   std::lock_guard<std::mutex> lock(r.mutex);
+   r.finished.fill(0);
+
+   for (auto* t: r.threads) {
+      for (auto& c: t->counts) {
+         c.store(0, std::memory_order_relaxed);
+      }
+   }
+}
+
+POLYLOGARITHM_INLINE void print_branch_counts(std::ostream& ostr)
+{
+   using namespace detail::branch_counter;
+
+   if (!branch_counters_enabled()) {
+      ostr << "branch counters are disabled, define POLYLOGARITHM_BRANCH_COUNTERS to enable them\n";
+      return;
+   }
+
+   std::array<uint64_t, N> counts{};
+
+   for (std::size_t i = 0; i < N; ++i) {
+      counts[i] = branch_count(static_cast<Branch>(i));
+   }
+
+   for (std::size_t first = 0; first < N; ) {
+      // branches [first, last) belong to the same group
+      std::size_t last = first + 1;
+      while (last < N && group(last) == group(first)) {
+         ++last;
+      }
+
+      uint64_t total = 0;
+      for (std::size_t i = first; i < last; ++i) {
+         total += counts[i];
+      }
+
+      if (total != 0) {
+         ostr << group(first) << ": " << total << " calls\n";
+         for (std::size_t i = first; i < last; ++i) {
+            if (counts[i] == 0) {
+               continue;
+            }
+            const std::string name(names[i]);
+            ostr << "   " << std::left << std::setw(32) << name.substr(name.find(':') + 2)
+                 << std::right << std::setw(12) << counts[i]
+                 << std::setw(9) << std::fixed << std::setprecision(2)
+                 << 100.0*counts[i]/total << " %\n";
+         }
+      }
+
+      first = last;
+   }
+}
+
+} // namespace polylogarithm
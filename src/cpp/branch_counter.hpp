@@ -0,0 +1,95 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+/**
+ * If POLYLOGARITHM_BRANCH_COUNTERS is defined, the functions count
+ * for each call which transformation branch is taken.  The counters
+ * are kept per thread and can be queried with branch_count() and
+ * thread_branch_count().  Otherwise POLYLOGARITHM_COUNT_BRANCH expands
+ * to nothing and all counts are zero.
+ *
+ * Nested calls are counted per function: if a function forwards to
+ * another counted function, both count their branch.  For example,
+ * Li2(std::complex<double>) with Im(z) = 0 counts Li2_z_real and the
+ * branch of Li2(double) it calls, and Li(n,z) with 2 <= n <= 6 counts
+ * Li_dedicated and the branch of Li2, ..., Li6.  So the counts of one
+ * group sum up to the number of calls of that function, including the
+ * nested ones.  Li2_fast and Li3_fast count the branches of Li2(double)
+ * and Li3(double), respectively.
+ */
+#ifdef POLYLOGARITHM_BRANCH_COUNTERS
+#  define POLYLOGARITHM_COUNT_BRANCH(b) \
+   ::polylogarithm::detail::count_branch(::polylogarithm::Branch::b)
+#else
+#  define POLYLOGARITHM_COUNT_BRANCH(b) do {} while (0)
+#endif
+
+namespace polylogarithm {
+
+/// transformation branches of the double precision functions
+enum class Branch : std::size_t {
+   // Li2(double)
+   Li2_x_lt_m1, Li2_x_eq_m1, Li2_x_lt_0, Li2_x_eq_0, Li2_x_lt_half,
+   Li2_x_lt_1, Li2_x_eq_1, Li2_x_lt_2, Li2_x_ge_2,
+   // Li2(std::complex<double>)
+   Li2_z_real, Li2_z_small, Li2_z_re_le_half_abs_gt_1, Li2_z_re_le_half_abs_le_1,
+   Li2_z_re_gt_half_near_1, Li2_z_re_gt_half_far_1,
+   // Li3(double)
+   Li3_x_lt_m1, Li3_x_eq_m1, Li3_x_lt_0, Li3_x_eq_0, Li3_x_lt_half,
+   Li3_x_eq_half, Li3_x_lt_1, Li3_x_eq_1, Li3_x_lt_2, Li3_x_ge_2,
+   // Li3(std::complex<double>)
+   Li3_z_real, Li3_z_log_lt_1, Li3_z_abs_le_1, Li3_z_abs_gt_1,
+   // Li4(double)
+   Li4_x_lt_m1, Li4_x_eq_m1, Li4_x_abs_lt_1, Li4_x_eq_1, Li4_x_gt_1,
+   Li4_approx_neg, Li4_approx_half, Li4_approx_mid, Li4_approx_one,
+   // Li4(std::complex<double>)
+   Li4_z_real, Li4_z_log_lt_1, Li4_z_abs_le_1, Li4_z_abs_gt_1,
+   // Li5(std::complex<double>)
+   Li5_z_special, Li5_z_log_lt_1, Li5_z_abs_le_1, Li5_z_abs_gt_1,
+   // Li6(std::complex<double>)
+   Li6_z_special, Li6_z_log_lt_1, Li6_z_abs_le_1, Li6_z_abs_gt_1,
+   // Li(int64_t, std::complex<double>)
+   Li_special, Li_neg_series, Li_neg_unity, Li_neg_inversion,
+   Li_closed_form, Li_dedicated, Li_series, Li_inversion, Li_unity_pos,
+   NUMBER_OF_BRANCHES
+};
+
+/// returns true if the library was compiled with POLYLOGARITHM_BRANCH_COUNTERS
+bool branch_counters_enabled() noexcept;
+
+/// returns a description of the branch, e.g. "Li2(x): x < -1"
+const char* branch_name(Branch) noexcept;
+
+/// returns the number of calls that took the branch, summed over all threads
+uint64_t branch_count(Branch) noexcept;
+
+/// returns the number of calls of the calling thread that took the branch
+uint64_t thread_branch_count(Branch) noexcept;
+
+/// resets the counters of all threads, must not run concurrently with counted calls
+void reset_branch_counts() noexcept;
+
+/// prints the non-zero counts, summed over all threads, grouped by function
+void print_branch_counts(std::ostream&);
+
+namespace detail {
+
+/// increments the counter of the branch for the calling thread
+void count_branch(Branch) noexcept;
+
+} // namespace detail
+
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "branch_counter.cpp"
+#endif
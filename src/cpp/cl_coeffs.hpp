@@ -0,0 +1,159 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+
+/**
+ * Coefficients of the rational function approximations of the double
+ * precision Clausen functions Cl2, ..., Cl6, shared by Cl2.cpp, ...,
+ * Cl6.cpp and Cl_all.cpp.  The lo tables approximate the functions for
+ * x in [0,pi/2), the hi tables for x in [pi/2,pi].
+ */
+
+namespace polylogarithm {
+namespace detail {
+namespace cl_coeffs {
+
+   /// coefficient tables, a class template to have a single definition
+   /// in header-only mode
+   template <typename T = double>
+   struct Tables {
+      static constexpr T cl2_p_lo[4] = {
+         1.3888888888888889e-02, -4.3286930203743071e-04,
+         3.2779814789973427e-06, -3.6001540369575084e-09
+      };
+
+      static constexpr T cl2_q_lo[4] = {
+         1.0000000000000000e+00, -3.6166589746694121e-02,
+         3.6015827281202639e-04, -8.3646182842184428e-07
+      };
+
+      static constexpr T cl2_p_hi[6] = {
+         6.4005702446195512e-01, -2.0641655351338783e-01,
+         2.4175305223497718e-02, -1.2355955287855728e-03,
+         2.5649833551291124e-05, -1.4783829128773320e-07
+      };
+
+      static constexpr T cl2_q_hi[6] = {
+         1.0000000000000000e+00, -2.5299102015666356e-01,
+         2.2148751048467057e-02, -7.8183920462457496e-04,
+         9.5432542196310670e-06, -1.8184302880448247e-08
+      };
+
+      static constexpr T cl3_p_lo[4] = {
+         -7.5000000000000001e-01,  1.5707637881835541e-02,
+         -3.5426736843494423e-05, -2.4408931585123682e-07
+      };
+
+      static constexpr T cl3_q_lo[4] = {
+         1.0000000000000000e+00, -2.5573146805410089e-02,
+         1.5019774853075050e-04, -1.0648552418111624e-07
+      };
+
+      static constexpr T cl3_p_hi[6] = {
+         -4.9017024647634973e-01, 4.1559155224660940e-01,
+         -7.9425531417806701e-02, 5.9420152260602943e-03,
+         -1.8302227163540190e-04, 1.8027408929418533e-06
+      };
+
+      static constexpr T cl3_q_hi[6] = {
+         1.0000000000000000e+00, -1.9495887541644712e-01,
+         1.2059410236484074e-02, -2.5235889467301620e-04,
+         1.0199322763377861e-06,  1.9612106499469264e-09
+      };
+
+      static constexpr T cl4_p_lo[4] = {
+         -3.0555555555555556e-01,  6.0521392328447206e-03,
+         -1.9587493942041528e-05, -3.1137343767030358e-08
+      };
+
+      static constexpr T cl4_q_lo[4] = {
+         1.0000000000000000e+00, -2.2079728398400851e-02,
+         1.0887447112236682e-04, -6.1847621370547954e-08
+      };
+
+      static constexpr T cl4_p_hi[6] = {
+         7.6223911686491336e-01, -2.4339587368267260e-01,
+         2.8715364937979943e-02, -1.5368612510964667e-03,
+         3.6261044225761673e-05, -2.8557977333851308e-07
+      };
+
+      static constexpr T cl4_q_hi[6] = {
+         1.0000000000000000e+00, -1.7465715261403233e-01,
+         9.5439417991615653e-03, -1.7325070821666274e-04,
+         5.9283675098376635e-07,  9.4127575773361230e-10
+      };
+
+      static constexpr T cl5_p_lo[4] = {
+         1.0369277551433699e+00, -6.1354800479984468e-01,
+         9.4076401395712763e-02, -9.4056155866704436e-04
+      };
+
+      static constexpr T cl5_q_lo[5] = {
+         1.0000000000000000e+00, -1.2073698633244778e-02,
+         1.3703409625482991e-05, -1.9701280330628469e-09,
+         2.1944550184416500e-11
+      };
+
+      static constexpr T cl5_p_hi[6] = {
+         -4.5930112735784898e-01, 4.3720705508867954e-01,
+         -7.5895226486465095e-02, 5.2244176912488065e-03,
+         -1.5677716622013956e-04, 1.6641624171748576e-06
+      };
+
+      static constexpr T cl5_q_hi[6] = {
+          1.0000000000000000e+00, -1.2211486825401188e-01,
+          3.8940070749313620e-03, -2.2674805547074318e-05,
+         -7.4383354448335299e-08, -3.4131758392216437e-10
+      };
+
+      static constexpr T cl6_p_lo[4] = {
+         1.0369277551433699e+00, -2.087195444107175e-01,
+         2.0652251045312954e-02, -1.383438138256840e-04
+      };
+
+      static constexpr T cl6_q_lo[4] = {
+         1.0000000000000000e+00, -8.0784096827362542e-03,
+         5.8074568862993102e-06, -5.1960620033050114e-10
+      };
+
+      static constexpr T cl6_p_hi[5] = {
+         7.9544504578027050e-01, -1.9255025309738589e-01,
+         1.5805208288846591e-02, -5.4175380521534706e-04,
+         6.7577493541009068e-06
+      };
+
+      static constexpr T cl6_q_hi[6] = {
+         1.0000000000000000e+00, -7.0798422394109274e-02,
+         7.1744189715634762e-04,  3.9098747334347093e-06,
+         3.5669441618295266e-08,  2.5315391843409925e-10
+      };
+   };
+
+   template <typename T> constexpr T Tables<T>::cl2_p_lo[4];
+   template <typename T> constexpr T Tables<T>::cl2_q_lo[4];
+   template <typename T> constexpr T Tables<T>::cl2_p_hi[6];
+   template <typename T> constexpr T Tables<T>::cl2_q_hi[6];
+   template <typename T> constexpr T Tables<T>::cl3_p_lo[4];
+   template <typename T> constexpr T Tables<T>::cl3_q_lo[4];
+   template <typename T> constexpr T Tables<T>::cl3_p_hi[6];
+   template <typename T> constexpr T Tables<T>::cl3_q_hi[6];
+   template <typename T> constexpr T Tables<T>::cl4_p_lo[4];
+   template <typename T> constexpr T Tables<T>::cl4_q_lo[4];
+   template <typename T> constexpr T Tables<T>::cl4_p_hi[6];
+   template <typename T> constexpr T Tables<T>::cl4_q_hi[6];
+   template <typename T> constexpr T Tables<T>::cl5_p_lo[4];
+   template <typename T> constexpr T Tables<T>::cl5_q_lo[5];
+   template <typename T> constexpr T Tables<T>::cl5_p_hi[6];
+   template <typename T> constexpr T Tables<T>::cl5_q_hi[6];
+   template <typename T> constexpr T Tables<T>::cl6_p_lo[4];
+   template <typename T> constexpr T Tables<T>::cl6_q_lo[4];
+   template <typename T> constexpr T Tables<T>::cl6_p_hi[5];
+   template <typename T> constexpr T Tables<T>::cl6_q_hi[6];
+
+} // namespace cl_coeffs
+} // namespace detail
+} // namespace polylogarithm
@@ -0,0 +1,111 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <cmath>
+#include <cstdint>
+
+namespace polylogarithm {
+namespace detail {
+namespace cl {
+
+   constexpr double PI = 3.14159265358979324;
+   constexpr double PI2 = 2*PI;
+   constexpr int64_t N_THRESH = 9; // threshold to switch between series
+
+   // Binomial coefficents, [ binomial(n,k) for n=0:7, k=0:7 ]
+   constexpr int binomial[8][8] = {
+      {1, 0,  0,  0,   0,   0,  0,  0},
+      {1, 1,  0,  0,   0,   0,  0,  0},
+      {1, 2,  1,  0,   0,   0,  0,  0},
+      {1, 3,  3,  1,   0,   0,  0,  0},
+      {1, 4,  6,  4,   1,   0,  0,  0},
+      {1, 5, 10, 10,   5,   1,  0,  0},
+      {1, 6, 15, 20,  15,   6,  1,  0},
+      {1, 7, 21, 35,  35,  21,  7,  1}
+   };
+
+   // 1/n! for n = 0,...,8
+   constexpr double inverse_factorial[] = {
+      1.0, 1.0, 1.0/2, 1.0/6, 1.0/24, 1.0/120, 1.0/720, 1.0/5040, 1.0/40320
+   };
+
+   // zeta(n) for n = 2,...,9
+   constexpr double zeta[] = {
+      1.6449340668482264, 1.2020569031595943, 1.0823232337111382,
+      1.0369277551433699, 1.0173430619844491, 1.0083492773819228,
+      1.0040773561979443, 1.0020083928260822
+   };
+
+   constexpr bool is_even(int64_t n) noexcept
+   {
+      return n % 2 == 0;
+   }
+
+   /// range-reduces x to be in [0,pi], returns sign (Cl.cpp)
+   double range_reduce(int64_t n, double& x) noexcept;
+
+   /// returns N_n(x) from Eq.(2.11) (Cl.cpp)
+   double ncal(int64_t n, double x) noexcept;
+
+   // returns P_n(x)
+   template <int64_t n>
+   double pcal(double x) noexcept
+   {
+      double sum = 0;
+      const auto x2 = x*x;
+
+      for (int64_t i = 3; i <= n; i += 2) {
+         const double sign = is_even((n - 1)/2 + (i - 1)/2) ? 1.0 : -1.0;
+         sum = x2*sum + sign*zeta[i - 2]*inverse_factorial[n - i];
+      }
+
+      if (is_even(n)) {
+         sum *= x;
+      }
+
+      return sum;
+   }
+
+   // returns sum in Eq.(2.13)
+   template <int64_t n>
+   double nsum(double x) noexcept
+   {
+      double sum = 0;
+      double xn = 1;
+
+      for (int64_t i = 0; i <= n - 3; ++i) {
+         sum += binomial[n - 2][i]*xn*ncal(n - 2 - i, x);
+         xn *= -x;
+      }
+
+      return sum + xn*ncal(0, x);
+   }
+
+   // returns Cl(n,x) from Eq.(2.13) for x in [0,pi]
+   template <int64_t n>
+   double cl_wu(double x) noexcept
+   {
+      const double sign1 = is_even((n + 1)/2) ? 1.0 : -1.0;
+
+      // first line in Eq.(2.13)
+      const double term1 = x == 0 ? 0
+         : sign1*std::pow(x, n - 1)*inverse_factorial[n - 1] *
+           std::log(2*std::sin(x/2));
+
+      const double sign2 = is_even(n/2) ? 1.0 : -1.0;
+
+      // second line in Eq.(2.13)
+      const double term2 = pcal<n>(x) - sign2*inverse_factorial[n - 2]*nsum<n>(x);
+
+      // Eq.(2.13)
+      return term1 + term2;
+   }
+
+} // namespace cl
+} // namespace detail
+} // namespace polylogarithm
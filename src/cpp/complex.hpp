@@ -22,7 +22,8 @@ struct Complex {
 template <typename T>
 constexpr T arg(const Complex<T>& z) noexcept
 {
-   return std::atan2(z.im, z.re);
+   using std::atan2;
+   return atan2(z.im, z.re);
 }
 
 template <typename T>
@@ -34,19 +35,32 @@ constexpr Complex<T> conj(const Complex<T>& z) noexcept
 template <typename T>
 Complex<T> log(const Complex<T>& z) noexcept
 {
+   using std::log;
    T a = arg(z);
 
    if (z.im == T(0) && a < T(0)) {
       a = -a;
    }
 
-   return { std::log(norm(z)), a };
+   return { log(norm(z)), a };
+}
+
+/// returns log(1 + z), accurate for small |z|
+template <typename T>
+Complex<T> log1p(const Complex<T>& z) noexcept
+{
+   using std::atan2;
+   using std::log1p;
+   const T x = z.re + T(1);
+
+   return { T(0.5)*log1p(z.re*(T(2) + z.re) + z.im*z.im), atan2(z.im, x) };
 }
 
 template <typename T>
 constexpr T norm(const Complex<T>& z) noexcept
 {
-   return std::hypot(z.re, z.im);
+   using std::hypot;
+   return hypot(z.re, z.im);
 }
 
 template <typename T>
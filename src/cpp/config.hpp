@@ -0,0 +1,20 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+
+/**
+ * If POLYLOGARITHM_HEADER_ONLY is defined, the headers include the
+ * corresponding source files and all functions are defined inline.
+ * The compiler can then inline the kernels into the calling loops.
+ * In this case no library needs to be linked, except for the thread
+ * library required by parallel.hpp.
+ */
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#  define POLYLOGARITHM_INLINE inline
+#else
+#  define POLYLOGARITHM_INLINE
+#endif
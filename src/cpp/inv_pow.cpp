@@ -0,0 +1,134 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "inv_pow.hpp"
+#include <cmath>
+#include <deque>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+
+namespace polylogarithm {
+
+namespace detail {
+namespace inv_pow_cache {
+
+using Table = std::shared_ptr<const std::vector<double>>;
+
+/// tables of k^(-n), shared between all threads
+struct Cache {
+   std::mutex mutex;
+   std::unordered_map<int64_t, Table> tables;
+   std::deque<int64_t> order; ///< insertion order, oldest first
+   std::size_t size{0};       ///< number of bytes occupied by the tables
+};
+
+POLYLOGARITHM_INLINE Cache& cache()
+{
+   static Cache c;
+   return c;
+}
+
+POLYLOGARITHM_INLINE std::size_t bytes(const Table& t) noexcept
+{
+   return t->size()*sizeof(double);
+}
+
+POLYLOGARITHM_INLINE Table make_table(int64_t n)
+{
+   const auto eps = std::numeric_limits<double>::epsilon();
+   const auto kmax = static_cast<int64_t>(std::ceil(std::pow(eps, -1.0/n)));
+
+   std::vector<double> t(kmax);
+
+   for (int64_t k = 1; k <= kmax; ++k) {
+      t[k - 1] = std::pow(k, -n);
+   }
+
+   return std::make_shared<const std::vector<double>>(std::move(t));
+}
+
+} // namespace inv_pow_cache
+} // namespace detail
+
+/**
+ * @brief Returns the table of reciprocal powers \f$k^{-n}\f$
+ * @param n exponent
+ * @return table of \f$k^{-n}\f$ for \f$k = 1, \ldots, \lceil\epsilon^{-1/n}\rceil\f$
+ *
+ * The table contains the weights of the series expansions of the
+ * Clausen functions of order n.  It is intended for n >= 10, where it
+ * has at most 37 elements.
+ *
+ * The tables are computed on first use and cached.  The cache is
+ * shared between threads and protected by a mutex.  The last table
+ * used by a thread is in addition kept in a thread-local variable, so
+ * that repeated calls with the same n do not lock the mutex.  If the
+ * cached tables exceed INV_POW_CACHE_BUDGET bytes, the oldest tables
+ * are removed from the cache.  Removed tables stay valid as long as
+ * they are referenced by the returned pointer.
+ */
+POLYLOGARITHM_INLINE std::shared_ptr<const std::vector<double>> inv_pow(int64_t n)
+{
+   thread_local int64_t last_n = 0;
+   thread_local detail::inv_pow_cache::Table last;
+
+   if (last && last_n == n) {
+      return last;
+   }
+
+   detail::inv_pow_cache::Cache& c = detail::inv_pow_cache::cache();
+   detail::inv_pow_cache::Table t;
+
+   {
+      std::lock_guard<std::mutex> lock(c.mutex);
+      const auto it = c.tables.find(n);
+      if (it != c.tables.end()) {
+         t = it->second;
+      }
+   }
+
+   if (!t) {
+      // compute the table outside of the lock
+      t = detail::inv_pow_cache::make_table(n);
+
+      std::lock_guard<std::mutex> lock(c.mutex);
+      const auto ins = c.tables.emplace(n, t);
+
+      if (ins.second) {
+         c.order.push_back(n);
+         c.size += detail::inv_pow_cache::bytes(t);
+
+         while (c.size > INV_POW_CACHE_BUDGET && c.order.size() > 1) {
+            const auto oldest = c.tables.find(c.order.front());
+            c.size -= detail::inv_pow_cache::bytes(oldest->second);
+            c.tables.erase(oldest);
+            c.order.pop_front();
+         }
+      } else {
+         // another thread has inserted the table in the meantime
+         t = ins.first->second;
+      }
+   }
+
+   last_n = n;
+   last = t;
+
+   return t;
+}
+
+/**
+ * @brief Returns the memory occupied by the cached tables
+ * @return number of bytes occupied by the tables in the cache
+ */
+POLYLOGARITHM_INLINE std::size_t inv_pow_cache_size()
+{
+   detail::inv_pow_cache::Cache& c = detail::inv_pow_cache::cache();
+   std::lock_guard<std::mutex> lock(c.mutex);
+   return c.size;
+}
+
+} // namespace polylogarithm
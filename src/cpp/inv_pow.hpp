@@ -0,0 +1,29 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace polylogarithm {
+
+/// maximum number of bytes occupied by the tables returned by inv_pow()
+constexpr std::size_t INV_POW_CACHE_BUDGET = 128*1024;
+
+/// table of k^(-n) for k = 1, ..., ceil(eps^(-1/n)) for integer n >= 10
+std::shared_ptr<const std::vector<double>> inv_pow(int64_t n);
+
+/// number of bytes currently occupied by the cached inv_pow() tables
+std::size_t inv_pow_cache_size();
+
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "inv_pow.cpp"
+#endif
@@ -0,0 +1,166 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "complex.hpp"
+
+/**
+ * Coefficients of the double precision polylogarithms Li2, ..., Li6,
+ * shared by Li2.cpp, ..., Li6.cpp and Li_all.cpp.  The bf tables
+ * contain the coefficients of the series in u = -log(1-z), the cs
+ * tables those of the series in log(z) for |log(z)| < 1.
+ */
+
+namespace polylogarithm {
+namespace detail {
+namespace li_coeffs {
+
+   /// returns coeffs[Nstart] + ... + coeffs[Nend-1]*z^(Nend-1-Nstart)
+   template <int Nstart, int Nend, typename T, int N>
+   Complex<T> horner(const Complex<T>& z, const T (&coeffs)[N]) noexcept
+   {
+      static_assert(0 <= Nstart && Nstart < Nend - 1 && Nend <= N, "invalid array bounds");
+
+      const T r = z.re + z.re;
+      const T s = z.re * z.re + z.im * z.im;
+      T a = coeffs[Nend - 1], b = coeffs[Nend - 2];
+
+      for (int i = Nend - 3; i >= Nstart; --i) {
+         const T t = a;
+         a = b + r * a;
+         b = coeffs[i] - s * t;
+      }
+
+      return Complex<T>(z.re*a + b, z.im*a);
+   }
+
+   /// returns coeffs[Nstart] + ... + coeffs[N-1]*z^(N-1-Nstart)
+   template <int Nstart, typename T, int N>
+   Complex<T> horner(const Complex<T>& z, const T (&coeffs)[N]) noexcept
+   {
+      return horner<Nstart, N>(z, coeffs);
+   }
+
+   /// coefficient tables, a class template to have a single definition
+   /// in header-only mode
+   template <typename T = double>
+   struct Tables {
+      // bf[1..N-1] are the even Bernoulli numbers / (2 n + 1)!
+      // generated by: Table[BernoulliB[2 n]/(2 n + 1)!, {n, 1, 10}]
+      // Li2(z) uses the first 10 coefficients, where |u| is smaller
+      static constexpr T li2_bf[11] = {
+         - 1.0/4.0,
+         + 1.0/36.0,
+         - 1.0/3600.0,
+         + 1.0/211680.0,
+         - 1.0/10886400.0,
+         + 1.0/526901760.0,
+         - 4.0647616451442255e-11,
+         + 8.9216910204564526e-13,
+         - 1.9939295860721076e-14,
+         + 4.5189800296199182e-16,
+         - 1.0356517612181247e-17
+      };
+
+      // generated by: Table[Zeta[1 - 2 n]/(2 n + 1)!, {n, 1, 9}]
+      static constexpr T li2_cs[9] = {
+         -1.3888888888888889e-02, 6.9444444444444444e-05,
+         -7.8735197782816830e-07, 1.1482216343327455e-08,
+         -1.8978869988970999e-10, 3.3873013709535212e-12,
+         -6.3726364431831808e-14, 1.2462059912950672e-15,
+         -2.5105444608999546e-17
+      };
+
+      static constexpr T li3_bf[18] = {
+         1.0                   , -3.0/8.0               ,
+         17.0/216.0            , -5.0/576.0             ,
+         1.2962962962962963e-04,  8.1018518518518519e-05,
+        -3.4193571608537595e-06, -1.3286564625850340e-06,
+         8.6608717561098513e-08,  2.5260875955320400e-08,
+        -2.1446944683640648e-09, -5.1401106220129789e-10,
+         5.2495821146008294e-11,  1.0887754406636318e-11,
+        -1.2779396094493695e-12, -2.3698241773087452e-13,
+         3.1043578879654623e-14,  5.2617586299125061e-15
+      };
+
+      static constexpr T li3_cs[7] = {
+         -3.4722222222222222e-03, 1.1574074074074074e-05,
+         -9.8418997228521038e-08, 1.1482216343327454e-09,
+         -1.5815724990809166e-11, 2.4195009792525152e-13,
+         -3.9828977769894877e-15
+      };
+
+      static constexpr T li4_bf[18] = {
+         1.0                   , -7.0/16.0              ,
+         1.1651234567901235e-01, -1.9820601851851852e-02,
+         1.9279320987654321e-03, -3.1057098765432099e-05,
+        -1.5624009114857835e-05,  8.4851235467732066e-07,
+         2.2909616603189711e-07, -2.1832614218526917e-08,
+        -3.8828248791720156e-09,  5.4462921032203321e-10,
+         6.9608052106827254e-11, -1.3375737686445215e-11,
+        -1.2784852685266572e-12,  3.2605628580248922e-13,
+         2.3647571168618257e-14, -7.9231351220311617e-15
+      };
+
+      static constexpr T li4_cs[7] = {
+         -6.9444444444444444e-04, 1.6534391534391534e-06,
+         -1.0935444136502338e-08, 1.0438378493934049e-10,
+         -1.2165942300622435e-12, 1.6130006528350101e-14,
+         -2.3428810452879340e-16
+      };
+
+      static constexpr T li5_bf[19] = {
+         1.0                   , -15.0/32.0             ,
+         1.3953189300411523e-01, -2.8633777006172840e-02,
+         4.0317412551440329e-03, -3.3985018004115226e-04,
+         4.5445184621617666e-06,  2.3916808048569012e-06,
+        -1.2762692600122747e-07, -3.1628984306505932e-08,
+         3.2848118445335192e-09,  4.7613713995660579e-10,
+        -8.0846898171909830e-11, -7.2387648587737207e-12,
+         1.9439760115173968e-12,  1.0256978405977236e-13,
+        -4.6180551009884830e-14, -1.1535857196470580e-15,
+         1.0903545401333394e-15
+      };
+
+      static constexpr T li5_cs[6] = {
+         -1.1574074074074074e-04, 2.0667989417989418e-07,
+         -1.0935444136502338e-09, 8.6986487449450412e-12,
+         -8.6899587861588824e-14, 1.0081254080218813e-15
+      };
+
+      static constexpr T li6_bf[18] = {
+         1.0                   , -31.0/64.0             ,
+         1.5241340877914952e-01, -3.4365555877057613e-02,
+         5.7174797239368999e-03, -6.8180453746570645e-04,
+         4.9960361948734493e-05, -4.9166051196039048e-07,
+        -3.0632975161302164e-07,  1.4414599270849095e-08,
+         3.7272438230924107e-09, -3.7300867345487607e-10,
+        -5.1246526816085832e-11,  9.0541930956636683e-12,
+         6.7381882615512517e-13, -2.1215831150303135e-13,
+        -6.8408811719011698e-15,  4.8691178462005581e-15
+      };
+
+      static constexpr T li6_cs[5] = {
+         -1.6534391534391534e-05, 2.2964432686654909e-08,
+         -9.9413128513657614e-11, 6.6912682653423394e-13,
+         -5.7933058574392549e-15
+      };
+   };
+
+   template <typename T> constexpr T Tables<T>::li2_bf[11];
+   template <typename T> constexpr T Tables<T>::li2_cs[9];
+   template <typename T> constexpr T Tables<T>::li3_bf[18];
+   template <typename T> constexpr T Tables<T>::li3_cs[7];
+   template <typename T> constexpr T Tables<T>::li4_bf[18];
+   template <typename T> constexpr T Tables<T>::li4_cs[7];
+   template <typename T> constexpr T Tables<T>::li5_bf[19];
+   template <typename T> constexpr T Tables<T>::li5_cs[6];
+   template <typename T> constexpr T Tables<T>::li6_bf[18];
+   template <typename T> constexpr T Tables<T>::li6_cs[5];
+
+} // namespace li_coeffs
+} // namespace detail
+} // namespace polylogarithm
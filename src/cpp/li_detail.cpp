@@ -0,0 +1,42 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "li_detail.hpp"
+
+namespace polylogarithm {
+namespace detail {
+namespace li {
+
+POLYLOGARITHM_INLINE std::complex<double> clog(const std::complex<double>& z) noexcept
+{
+   const double n = std::hypot(std::real(z), std::imag(z));
+   double a = std::arg(z);
+
+   if (std::imag(z) == 0.0 && a < 0.0) {
+      a = -a;
+   }
+
+   return { std::log(n), a };
+}
+
+POLYLOGARITHM_INLINE double pow_int(double x, int64_t n) noexcept
+{
+   double result = 1;
+
+   while (n > 0) {
+      if (n & 1) {
+         result *= x;
+      }
+      x *= x;
+      n >>= 1;
+   }
+
+   return result;
+}
+
+} // namespace li
+} // namespace detail
+} // namespace polylogarithm
@@ -0,0 +1,121 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include "eta.hpp"
+#include "factorial.hpp"
+#include "zeta.hpp"
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <limits>
+
+namespace polylogarithm {
+namespace detail {
+namespace li {
+
+   constexpr double inf = std::numeric_limits<double>::infinity();
+   constexpr double nan = std::numeric_limits<double>::quiet_NaN();
+   constexpr double PI = 3.1415926535897932;
+
+   constexpr bool is_even(int64_t n) noexcept { return n % 2 == 0; }
+
+   constexpr bool is_finite(const std::complex<double>& z) noexcept
+   {
+      return std::isfinite(std::real(z)) && std::isfinite(std::imag(z));
+   }
+
+   /// complex logarithm, converts -0.0 to 0.0
+   std::complex<double> clog(const std::complex<double>& z) noexcept;
+
+   /// returns x^n for n >= 0 by binary exponentiation
+   double pow_int(double x, int64_t n) noexcept;
+
+   /// series expansion of Li_n(z) in terms of powers of z (Li.cpp)
+   std::complex<double> Li_series(int64_t n, const std::complex<double>& z) noexcept;
+
+   /// terms j >= n - 1 of the series expansion of Li_n(z) around z ~ 1,
+   /// added to sum, where p = log(z)^(n-2)/(n-2)! (Li.cpp)
+   std::complex<double> Li_unity_pos_tail(
+      int64_t n, const std::complex<double>& lnz, std::complex<double> p,
+      std::complex<double> sum) noexcept;
+
+   /// largest order for which Li<N>(z) unrolls the sums with fixed length
+   constexpr int64_t N_UNROLL = 64;
+
+   /// adds the terms j = J, ..., N - 2 of the series around z ~ 1
+   template <int64_t N, int64_t J, bool = (J < N - 1)>
+   struct UnityPosHead {
+      static void add(const std::complex<double>& lnz, std::complex<double>& p, std::complex<double>& sum) noexcept
+      {
+         constexpr double c = zeta(N - J);
+         p *= lnz/static_cast<double>(J);
+         sum += c*p;
+         UnityPosHead<N, J + 1>::add(lnz, p, sum);
+      }
+   };
+
+   template <int64_t N, int64_t J>
+   struct UnityPosHead<N, J, false> {
+      static void add(const std::complex<double>&, std::complex<double>&, std::complex<double>&) noexcept {}
+   };
+
+   /// adds the terms k = K, ..., 1 of the remainder of the inversion formula
+   template <int64_t N, int64_t K>
+   struct RestSum {
+      static void add(const std::complex<double>& lnz2, std::complex<double>& p, std::complex<double>& sum) noexcept
+      {
+         constexpr double c = neg_eta(2*K)*inv_fac(N - 2*K);
+         sum += c*p;
+         p *= lnz2;
+         if (sum == 0.0) { return; }
+         RestSum<N, K - 1>::add(lnz2, p, sum);
+      }
+   };
+
+   template <int64_t N>
+   struct RestSum<N, 0> {
+      static void add(const std::complex<double>&, std::complex<double>&, std::complex<double>&) noexcept {}
+   };
+
+   /// series expansion of Li_N(z) around z ~ 1 for 6 < N <= N_UNROLL
+   template <int64_t N>
+   std::complex<double> Li_unity_pos(const std::complex<double>& z) noexcept
+   {
+      static_assert(N > 2 && N <= N_UNROLL, "order out of range");
+
+      const std::complex<double> lnz = clog(z);
+      std::complex<double> sum(zeta(N), 0.0), p(1.0, 0.0);
+
+      UnityPosHead<N, 1>::add(lnz, p, sum);
+
+      return Li_unity_pos_tail(N, lnz, p, sum);
+   }
+
+   /// remainder from the inversion formula for 6 < N <= N_UNROLL
+   template <int64_t N>
+   std::complex<double> Li_rest(const std::complex<double>& z) noexcept
+   {
+      static_assert(N > 0 && N <= N_UNROLL, "order out of range");
+
+      const std::complex<double> lnz = clog(-z);
+      const std::complex<double> lnz2 = lnz*lnz;
+      std::complex<double> p = is_even(N) ? 1.0 : lnz;
+      std::complex<double> sum(0.0, 0.0);
+
+      RestSum<N, is_even(N) ? N/2 : (N - 1)/2>::add(lnz2, p, sum);
+
+      return 2.0*sum - p*inv_fac(N);
+   }
+
+} // namespace li
+} // namespace detail
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "li_detail.cpp"
+#endif
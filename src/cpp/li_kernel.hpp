@@ -0,0 +1,836 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "complex.hpp"
+#include <cfloat>
+#include <cmath>
+#include <limits>
+
+/**
+ * Type-generic polylogarithms Li2, ..., Li6 for real types with more
+ * than double precision.  They are instantiated for long double
+ * (Li2.cpp, ..., Li6.cpp), DoubleDouble (Li_dd.cpp) and __float128
+ * (Li_float128.cpp).  The coefficients are stored as the unevaluated
+ * sum of three doubles, which is exact to about 159 bits, so that all
+ * these types share one table.
+ */
+
+namespace polylogarithm {
+namespace detail {
+namespace li_kernel {
+
+   /// real number hi + mi + lo
+   struct Triple {
+      double hi, mi, lo;
+   };
+
+   /// elementary functions and precision of the real type T, must be
+   /// specialized for each type the kernels are instantiated for
+   template <typename T>
+   struct Real;
+
+   template <>
+   struct Real<long double> {
+      static constexpr int digits = LDBL_MANT_DIG;
+      static long double eps() noexcept { return std::numeric_limits<long double>::epsilon(); }
+      static long double log(long double x) noexcept { return std::log(x); }
+      static long double log1p(long double x) noexcept { return std::log1p(x); }
+      static long double atan2(long double y, long double x) noexcept { return std::atan2(y, x); }
+      static long double hypot(long double x, long double y) noexcept { return std::hypot(x, y); }
+   };
+
+   /// converts x to T
+   template <typename T>
+   T to(const Triple& x) noexcept
+   {
+      return T(x.hi) + (T(x.mi) + T(x.lo));
+   }
+
+   /// table of N coefficients converted to T
+   template <typename T, int N>
+   struct Table {
+      explicit Table(const Triple (&t)[N]) noexcept
+      {
+         for (int i = 0; i < N; ++i) {
+            c[i] = to<T>(t[i]);
+         }
+      }
+      T c[N];
+   };
+
+   /// number of series terms needed for T, n64 for a mantissa of up
+   /// to 64 bits (x87 long double) and n113 for up to 113 bits
+   template <typename T>
+   constexpr int terms(int n64, int n113) noexcept
+   {
+      return Real<T>::digits > 64 ? n113 : n64;
+   }
+
+   /// returns c[0] + c[1]*x + ... + c[n-1]*x^(n-1), n >= 1
+   template <typename T>
+   T horner(const T& x, const T* c, int n) noexcept
+   {
+      T p = c[n - 1];
+      for (int i = n - 2; i >= 0; --i) {
+         p = p*x + c[i];
+      }
+      return p;
+   }
+
+   /// returns c[0] + c[1]*z + ... + c[n-1]*z^(n-1), n >= 2
+   template <typename T>
+   Complex<T> horner(const Complex<T>& z, const T* c, int n) noexcept
+   {
+      const T r = z.re + z.re;
+      const T s = z.re * z.re + z.im * z.im;
+      T a = c[n - 1], b = c[n - 2];
+
+      for (int i = n - 3; i >= 0; --i) {
+         const T t = a;
+         a = b + r * a;
+         b = c[i] - s * t;
+      }
+
+      return Complex<T>(z.re*a + b, z.im*a);
+   }
+
+   /// returns |z|
+   template <typename T>
+   T modulus(const Complex<T>& z) noexcept
+   {
+      return Real<T>::hypot(z.re, z.im);
+   }
+
+   /// returns arg(z)
+   template <typename T>
+   T phase(const Complex<T>& z) noexcept
+   {
+      return Real<T>::atan2(z.im, z.re);
+   }
+
+   /// returns log(|z|), accurate also for |z| close to 1
+   template <typename T>
+   T log_abs(const Complex<T>& z) noexcept
+   {
+      const T nz2 = norm_sqr(z);
+
+      if (nz2 > T(0.5) && nz2 < T(2)) {
+         return T(0.5)*Real<T>::log1p((z.re - T(1))*(z.re + T(1)) + z.im*z.im);
+      }
+
+      return Real<T>::log(modulus(z));
+   }
+
+   /// returns log(z), accurate also for |z| close to 1
+   template <typename T>
+   Complex<T> clog(const Complex<T>& z) noexcept
+   {
+      T a = phase(z);
+
+      if (z.im == T(0) && a < T(0)) {
+         a = -a;
+      }
+
+      return { log_abs(z), a };
+   }
+
+   /// returns log(1 + z), accurate for small |z| and for |1 + z| close to 1
+   template <typename T>
+   Complex<T> clog1p(const Complex<T>& z) noexcept
+   {
+      if (norm_sqr(z) < T(0.25)) {
+         const T x = T(1) + z.re;
+         return { T(0.5)*Real<T>::log1p(z.re*(T(2) + z.re) + z.im*z.im), Real<T>::atan2(z.im, x) };
+      }
+
+      return clog(T(1) + z);
+   }
+
+   /// returns log(-z) given arg(z) and log(|z|)
+   template <typename T>
+   Complex<T> log_neg(const T& pz, const T& lnz, const T& PI) noexcept
+   {
+      return { lnz, pz > T(0) ? pz - PI : pz + PI };
+   }
+
+namespace constants {
+
+   /// pi
+   constexpr Triple pi = {  3.14159265358979312e+00,  1.22464679914735321e-16, -2.99476980971833967e-33 };
+
+   /// zeta(2)
+   constexpr Triple zeta2 = {  1.64493406684822641e+00,  3.04067235039847616e-17, -2.00060492695252519e-33 };
+
+   /// zeta(3)
+   constexpr Triple zeta3 = {  1.20205690315959424e+00,  4.87589101037953180e-17, -2.98586410829429906e-33 };
+
+   /// zeta(4)
+   constexpr Triple zeta4 = {  1.08232323371113814e+00,  4.74851204285536475e-17,  8.51597294902755877e-34 };
+
+   /// zeta(5)
+   constexpr Triple zeta5 = {  1.03692775514336999e+00, -6.27678902037776789e-17, -1.39874873852746878e-34 };
+
+   /// zeta(6)
+   constexpr Triple zeta6 = {  1.01734306198444924e+00, -9.75859916644153129e-17,  8.35426452727804710e-34 };
+
+   /// Li3(1/2)
+   constexpr Triple li3_half = {  5.37213193608040207e-01, -6.09818856073813341e-18,  2.30643312347685822e-34 };
+
+   /// Li2: -1/4, followed by the Bernoulli numbers B_{2n}/(2n+1)!, n = 1, ..., 22
+   constexpr Triple li2_bf[] = {
+      { -2.50000000000000000e-01,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      {  2.77777777777777762e-02,  1.54197642309049511e-18,  8.55968864172104776e-35 },
+      { -2.77777777777777778e-04, -2.40933816107889874e-22, -2.08976773479517779e-40 },
+      {  4.72411186696900978e-06,  4.44324161295906617e-23, -1.39584400993334374e-39 },
+      { -9.18577307466196408e-08,  5.31231826009834369e-24,  1.08772963444696091e-40 },
+      {  1.89788699889710005e-09, -1.47357760489979441e-25,  5.72182066981130138e-42 },
+      { -4.06476164514422560e-11,  7.67649631346184459e-28, -4.86575347010743755e-45 },
+      {  8.92169102045645230e-13,  2.50408828849385376e-29, -7.09781361319098267e-46 },
+      { -1.99392958607210744e-14, -1.25281268539602288e-30,  4.70857726535248904e-47 },
+      {  4.51898002961991825e-16, -5.90601624309692853e-33, -5.62818634256449584e-50 },
+      { -1.03565176121812472e-17,  1.62898753668581301e-34,  9.14728605308928917e-51 },
+      {  2.39521862102618698e-19, -2.36788456489539028e-35,  2.53858569341520864e-52 },
+      { -5.58178587432500898e-21, -3.53838309128148911e-37, -1.74027405729999558e-53 },
+      {  1.30915075541832125e-22,  3.53272467417175457e-39, -1.68457880877115749e-56 },
+      { -3.08741980242674029e-24, -7.53872323012252736e-42,  5.52667148180814082e-58 },
+      {  7.31597565270220293e-26,  4.94817608599011109e-42, -3.12120256726048784e-58 },
+      { -1.74084565723400088e-27,  1.35488278175049650e-43,  2.17384304233173080e-62 },
+      {  4.15763564461389988e-29, -1.60379020441231332e-45, -3.32729897099837336e-62 },
+      { -9.96214848828462168e-31, -4.18813237636111449e-47,  1.13455288024966098e-63 },
+      {  2.39403442489616522e-32,  8.15685062327249775e-49, -2.36313289555688933e-65 },
+      { -5.76834735536738970e-34, -3.88445408747958682e-50,  9.99573758280315380e-67 },
+      {  1.39317947964700803e-35, -5.54093104493112591e-52, -1.52738912257705492e-68 },
+      { -3.37212196548508943e-37, -4.49808075375012170e-54, -8.17171003180280920e-71 }
+   };
+
+   /// Li3: coefficients of u^(k+1) of Li3(1 - e^(-u)), k = 0, ..., 44
+   constexpr Triple li3_bf[] = {
+      {  1.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      { -3.75000000000000000e-01,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      {  7.87037037037037063e-02, -2.56996070515082518e-18, -1.42661477362017463e-34 },
+      { -8.68055555555555594e-03,  3.85494105772623777e-19,  2.13992216043026194e-35 },
+      {  1.29629629629629631e-04, -1.69456783995882535e-21, -9.70766771736853230e-38 },
+      {  8.10185185185185162e-05,  2.32902688904293528e-21,  1.74425946930904183e-37 },
+      { -3.41935716085375951e-06,  1.62412767397801141e-23, -1.22871167056688939e-39 },
+      { -1.32865646258503392e-06, -9.19059558415380309e-23,  9.43594104741700180e-40 },
+      {  8.66087175610985105e-08,  2.93217666384491286e-24,  9.68568546952103062e-41 },
+      {  2.52608759553203989e-08,  8.55218193621432901e-25,  4.35558319791015446e-41 },
+      { -2.14469446836406487e-09,  1.05574267414076632e-25, -4.64907294461265075e-42 },
+      { -5.14011062201297940e-10,  4.85258581801301379e-26, -2.50627951638630275e-42 },
+      {  5.24958211460082972e-11, -2.83622495426633274e-27, -1.05519976746610584e-43 },
+      {  1.08877544066363182e-11,  1.40576806009264628e-28,  2.90481078157856922e-45 },
+      { -1.27793960944936950e-12, -3.41161511519861726e-29,  1.27634929261693548e-45 },
+      { -2.36982417730874508e-13, -1.29623717580798930e-29, -3.36951250021420919e-46 },
+      {  3.10435788796546229e-14, -4.50146802313051880e-33,  8.83016534137341197e-50 },
+      {  5.26175862991250584e-15,  2.42952135843838066e-31, -1.97238417297052693e-47 },
+      { -7.53847954994926526e-16, -1.07789694875311847e-32,  2.39422432676897856e-49 },
+      { -1.18623225777522858e-16,  5.24811475703643670e-33, -1.13518716935193595e-49 },
+      {  1.83169799654913839e-17, -5.16596057142810513e-34, -1.21833988068812587e-50 },
+      {  2.70681710318373508e-18, -6.00842646578086254e-35,  2.46880425447383693e-51 },
+      { -4.45543389782963866e-19, -1.62435159552272808e-35, -3.30025396107067568e-52 },
+      { -6.23754849225569461e-20, -3.53709278145875915e-37,  3.49424522596320642e-54 },
+      {  1.08515215348745348e-20,  8.80409653318317266e-38, -8.23923370745761977e-56 },
+      {  1.44911748660360816e-21,  3.39913775985568199e-38, -2.30845317930039130e-54 },
+      { -2.64663397544589923e-22,  1.91591516686616628e-38,  1.21199209836562442e-54 },
+      { -3.38976534885101072e-23,  2.44383193492992068e-39,  3.93188440655602708e-56 },
+      {  6.46404773360331082e-24,  6.55105801048002315e-41, -2.63783004107363671e-57 },
+      {  7.97583448960241244e-25, -1.11367970415138755e-42, -7.90486701680788861e-59 },
+      { -1.58091787902874832e-25, -1.25729654078547073e-42, -2.57107230623751095e-59 },
+      { -1.88614997296228696e-26,  1.41479140433432331e-42,  3.06843814642953181e-59 },
+      {  3.87155366384184737e-27, -4.24832263465013450e-44,  1.88719492048609989e-60 },
+      {  4.48011750023456082e-28, -8.49092402540592613e-45, -5.91290004569402334e-61 },
+      { -9.49303387191183613e-29, -1.40747071180086140e-47,  2.21294195775427569e-64 },
+      { -1.06828138090773805e-29, -6.77813822507804981e-46, -4.41530530617322478e-63 },
+      {  2.33044789361030530e-30, -1.10750922377890651e-46, -8.19718746872480776e-63 },
+      {  2.55607757265197545e-31, -4.23512090623021810e-48,  1.24703530171318700e-64 },
+      { -5.72742160613725996e-32,  2.74508981185130657e-48,  2.13113758694004060e-64 },
+      { -6.13471321379642389e-33,  3.04151527116343815e-49,  3.58187397408649982e-67 },
+      {  1.40908086040689449e-33, -4.67709865178714713e-51, -2.02952055504010381e-67 },
+      {  1.47642223976665336e-34,  5.36047036374803478e-51,  5.91975265359187044e-67 },
+      { -3.47010516489959146e-35, -1.48088644133753588e-51, -1.42537106800932020e-67 },
+      { -3.56210662409746365e-36,  6.57407167711880059e-53,  1.11749988840561625e-70 },
+      {  8.55369656823692097e-37,  9.15093812605218565e-54, -3.97578380876001881e-71 }
+   };
+
+   /// Li3: coefficients zeta(-1-2k)/(4+2k)! of u^(4+2k) of Li3(e^u)
+   constexpr Triple li3_cs[] = {
+      { -3.47222222222222203e-03, -1.92747052886311889e-19, -1.06996108021513097e-35 },
+      {  1.15740740740740735e-05,  5.74727540507362306e-22, -1.95044988580883255e-39 },
+      { -9.84189972285210371e-08, -9.25675336033138846e-25,  9.03037476456054689e-41 },
+      {  1.14822163433274539e-09,  5.76731136317248528e-26,  9.36225360891079084e-43 },
+      { -1.58157249908091648e-11, -1.14154645895936527e-27,  3.60223893539082279e-44 },
+      {  2.41950097925251543e-13, -2.38025232091157654e-29, -1.30560714774918631e-45 },
+      { -3.98289777698948797e-15,  2.26293589358386613e-31, -2.18545200713400444e-47 },
+      {  6.92336661830592958e-17, -5.23680723221360593e-33,  6.45836557697948171e-50 },
+      { -1.25527223044997724e-18, -3.92323754959175682e-35,  7.50286222869501682e-52 },
+      {  2.35375400276846526e-20, -2.60796602406591857e-37,  7.30511529792526287e-54 },
+      { -4.53639890345868656e-22, -4.63435662134980950e-38,  7.84720848828651680e-55 },
+      {  8.94516967039264294e-24,  2.27963663429707023e-40, -8.71125811697897651e-57 },
+      { -1.79828400469549630e-25,  3.22080642848857572e-42, -1.86938235413466802e-58 },
+      {  3.67549976479373857e-27, -1.20852295782728618e-43,  2.75583129983047592e-60 },
+      { -7.62080797156479501e-29, -2.16491336568008903e-45,  5.54612720489846670e-62 },
+      {  1.60004196436948596e-30,  1.97216450637223003e-47, -3.05964333011373507e-64 },
+      { -3.39676114756037555e-32, -3.71214799889511223e-49,  1.22888068938929091e-65 },
+      {  7.28227228675776440e-34,  2.91145032648101883e-50,  3.59301845139974593e-69 },
+      { -1.57502264795800360e-35,  1.15142701273766972e-51,  6.39618282797416637e-68 },
+      {  3.43354009248058918e-37,  1.59625593329648737e-53, -6.61220204048177361e-70 }
+   };
+
+   /// Li4: coefficients of u^(k+1) of Li4(1 - e^(-u)), k = 0, ..., 44
+   constexpr Triple li4_bf[] = {
+      {  1.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      { -4.37500000000000000e-01,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      {  1.16512345679012350e-01, -3.94060641456459861e-18, -2.18747598621760109e-34 },
+      { -1.98206018518518531e-02,  1.28498035257541259e-18,  7.13307386810087313e-35 },
+      {  1.92793209876543207e-03,  2.82652844888171600e-20,  5.00147362718339591e-37 },
+      { -3.10570987654320961e-05, -2.69979726160896594e-21, -3.55167636349189337e-38 },
+      { -1.56240091148578365e-05,  1.19565394606284548e-21, -5.96675530517898477e-38 },
+      {  8.48512354677320614e-07,  4.99541514440621955e-23, -2.03931747874217775e-39 },
+      {  2.29096166031897112e-07,  2.20946696393975060e-24,  1.47325514484957700e-40 },
+      { -2.18326142185269172e-08,  2.53463867719394757e-25, -2.05895197811679674e-41 },
+      { -3.88282487917201523e-09, -3.46269597139274934e-25, -6.79037729522329938e-42 },
+      {  5.44629210322033207e-10,  5.30455348342556894e-27, -1.89884241219672927e-44 },
+      {  6.96080521068272540e-11,  1.01763617999791913e-28,  2.70039959385378442e-45 },
+      { -1.33757376864452159e-11,  6.67669346588402162e-28, -3.99420108164916205e-44 },
+      { -1.27848526852665723e-12,  6.85898101325310658e-29, -4.06468043156618881e-45 },
+      {  3.26056285802489223e-13,  1.28190771000572011e-30, -6.42866480393724028e-47 },
+      {  2.36475711686182588e-14, -1.47442008012935839e-30, -2.60178760361903203e-47 },
+      { -7.92313512203116191e-15,  2.06948918756222924e-31, -2.18110085929332423e-47 },
+      { -4.34529157099841861e-16, -1.10786184022601576e-32,  1.39084313851746938e-49 },
+      {  1.92362700625359194e-16,  7.37712604607194666e-33, -5.31609880384633641e-49 },
+      {  7.81241433319595475e-18, -8.35809988162590922e-35,  2.11024110486015761e-52 },
+      { -4.67180384480365514e-18, -3.76776525608299908e-34, -1.89355849478009680e-50 },
+      { -1.34353443298128485e-19,  6.74365054544661613e-36,  3.83958180011080310e-52 },
+      {  1.13568268513473431e-19,  1.28840251183828420e-36, -4.93579503083808800e-54 },
+      {  2.11527562024325864e-21,  4.79171025535625864e-38,  9.90868041540846510e-55 },
+      { -2.76420263347465156e-21, -1.78346073972643680e-37, -7.15369138519676548e-54 },
+      { -2.70681766082400668e-23,  2.54080551825832088e-39,  1.64040591976008589e-56 },
+      {  6.73720448286285765e-23, -4.38172739432310587e-39, -7.51940487219094288e-56 },
+      {  1.32872654566838220e-25,  9.31417311435452725e-42,  4.26164503567647411e-58 },
+      { -1.64437730563678274e-24,  8.85094535939229758e-41,  5.84687674713637539e-58 },
+      {  8.28360589993393381e-27,  2.97237536405702561e-43,  9.87996403679727899e-60 },
+      {  4.01908484950693532e-26, -2.52982755765722225e-42, -1.06325375661831932e-58 },
+      { -4.57571384448487883e-28, -2.08534770794533782e-44, -1.15304269769780661e-60 },
+      { -9.83641090946151318e-28,  4.00898353040792520e-44, -2.71530358448821183e-61 },
+      {  1.69003395560378502e-29,  9.13563799098002972e-46,  2.76409180848940119e-62 },
+      {  2.41048055630598072e-29,  1.27131105367640222e-45, -5.45638565358918877e-62 },
+      { -5.42661270567141799e-31, -2.57918421516357602e-47,  2.01406296627618669e-63 },
+      { -5.91424295887417644e-31, -3.45163759946042784e-47,  2.21400316951707111e-63 },
+      {  1.62321109010873719e-32, -1.14257894984769981e-48, -7.15215215391569620e-65 },
+      {  1.45275954377402755e-32,  4.11176614733245896e-49, -8.14362129600015294e-66 },
+      { -4.65389937002573718e-34,  1.33590700754396958e-50, -6.46549065497139143e-67 },
+      { -3.57238626244413297e-34, -2.08736853357615818e-50,  8.29911951759537725e-67 },
+      {  1.29761714880310303e-35, -7.06970968896232573e-52, -5.00820021632043945e-68 },
+      {  8.79357407773938870e-36, -1.91482103396545720e-52,  8.51410082612288771e-70 },
+      { -3.54800202048240304e-37, -5.31956455298730054e-54,  4.29862980237271529e-70 }
+   };
+
+   /// Li4: coefficients zeta(-1-2k)/(5+2k)! of u^(5+2k) of Li4(e^u)
+   constexpr Triple li4_cs[] = {
+      { -6.94444444444444471e-04,  2.65027197718678853e-20,  8.69343377674793880e-37 },
+      {  1.65343915343915351e-06, -6.91519490800733009e-23, -1.95791334200452952e-39 },
+      { -1.09354441365023382e-08,  6.32418840487898041e-25,  3.04416377735097652e-41 },
+      {  1.04383784939340493e-10,  1.71809294711833459e-27,  8.51113964446435621e-44 },
+      { -1.21659423006224355e-12,  2.09301756305144571e-29, -1.32515017618729393e-45 },
+      {  1.61300065283501008e-14,  5.16794199981647021e-31,  1.22181647063954571e-47 },
+      { -2.34288104528793416e-16,  1.91118354418242981e-32,  2.39814316089539942e-51 },
+      {  3.64387716752943670e-18, -3.56713220406494440e-34, -1.01053555999503136e-50 },
+      { -5.97748681166655787e-20, -5.88056240775519712e-36,  1.63002425379128453e-52 },
+      {  1.02337130555150670e-21, -7.67577987590921650e-38, -2.85992585841992203e-54 },
+      { -1.81455956138347470e-23, -1.03089660296432257e-39,  5.74900518251401642e-56 },
+      {  3.31302580384912713e-25, -3.46150270826897144e-42,  1.02185320117580744e-58 },
+      { -6.20097932653619376e-27, -2.84780365215873295e-43, -1.19395664319555880e-59 },
+      {  1.18564508541733504e-28, -6.06821361517160750e-45, -7.16961587889818481e-62 },
+      { -2.30933574895902870e-30, -1.61146512436694768e-46, -1.26585883841198995e-63 },
+      {  4.57154846962710290e-32, -1.15686852357813379e-48, -3.04459929334902125e-65 },
+      { -9.18043553394696067e-34, -3.77717959071598480e-50,  9.73722331305200130e-67 },
+      {  1.86724930429686276e-35, -1.44395845292009113e-52,  7.22521742956298308e-69 },
+      { -3.84151865355610588e-37, -1.87712834790511183e-53,  2.59560728380731361e-70 }
+   };
+
+   /// Li5: coefficients of u^(k+1) of Li5(1 - e^(-u)), k = 0, ..., 44
+   constexpr Triple li5_bf[] = {
+      {  1.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      { -4.68750000000000000e-01,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      {  1.39531893004115226e-01,  2.28440951568962271e-19, -1.94178121964968222e-35 },
+      { -2.86337770061728392e-02, -3.42661427353443358e-19, -1.90215303149356617e-35 },
+      {  4.03174125514403278e-03,  1.40111973235307311e-19, -3.91133387355917070e-36 },
+      { -3.39850180041152282e-04,  1.87057445436297422e-20,  1.17158756874149038e-36 },
+      {  4.54451846216176690e-06, -2.50984074132983854e-22,  1.64298892825439753e-38 },
+      {  2.39168080485690103e-06,  1.57252356327534247e-22, -4.10946940352823097e-39 },
+      { -1.27626926001227461e-07, -4.46617560085159792e-24,  8.77693241915994141e-41 },
+      { -3.16289843065059325e-08,  6.22052734288121944e-26, -2.31400326563971349e-42 },
+      {  3.28481184453351915e-09,  1.58217620264449482e-26, -2.94415543016127995e-43 },
+      {  4.76137139956605743e-10,  4.72307905005397918e-26, -1.21548242562563379e-42 },
+      { -8.08468981719098351e-11,  4.84901762908226234e-27, -3.49607242465049812e-44 },
+      { -7.23876485877372070e-12,  4.62231790568725544e-30,  2.77039011067498546e-46 },
+      {  1.94397601151739676e-12,  9.15811286126894962e-29, -3.44271015288887861e-45 },
+      {  1.02569784059772356e-13,  3.22531916408173674e-30,  6.44699618294110690e-47 },
+      { -4.61805510098848314e-14,  1.24080959071871350e-30, -3.00045144712393626e-47 },
+      { -1.15358571964705797e-15, -3.54792833883932062e-32, -2.16246794370955462e-49 },
+      {  1.09035454013333941e-15, -1.34079532668572995e-32,  1.35462881948741774e-48 },
+      {  2.31481363172925266e-18, -2.47609038296351451e-35, -5.15630247822261746e-52 },
+      { -2.56699170432652907e-17, -1.45945452232815801e-33, -4.62858648243903309e-50 },
+      {  4.57086206073149693e-19, -2.70950381892437249e-36,  8.19184320742397678e-53 },
+      {  6.03667796132057033e-19,  2.60832229011408512e-35,  1.26248955899752963e-52 },
+      { -2.16776249440624128e-20, -1.78697774808581911e-37, -7.64663100554266971e-54 },
+      { -1.41940966156001644e-20, -8.84938894580491753e-37, -3.53010473702799344e-53 },
+      {  7.50200095064138649e-22, -2.32554194687800549e-38,  3.20781300476755839e-55 },
+      {  3.33870453950783971e-22,  8.31822891692922203e-40, -1.85161799303307056e-56 },
+      { -2.30600404426203466e-23, -1.06317909201246995e-39, -8.82519292483034634e-57 },
+      { -7.85817324568948132e-24, -5.68676888835175512e-40,  5.79929350557371094e-57 },
+      {  6.66834530437388084e-25,  1.27802753453878987e-42, -8.13365921250823272e-60 },
+      {  1.85091565409252982e-25, -9.61151459182023345e-42,  5.43874938863817896e-58 },
+      { -1.85915294451740870e-26,  1.38453300710327180e-42, -9.70999338605001494e-60 },
+      { -4.36297464803458882e-27, -2.28300492988032572e-43,  8.09948785266218211e-60 },
+      {  5.06110760995292814e-28,  3.10189853978387834e-44, -1.11147527784441484e-60 },
+      {  1.02919182497568784e-28, -1.67495258564816365e-45, -1.33541112108731343e-61 },
+      { -1.35513912210183160e-29, -5.70349518331053198e-46, -3.68767828510593646e-62 },
+      { -2.42940596129573833e-30,  6.13197781070768343e-47, -4.66412777969436131e-63 },
+      {  3.58519739665037069e-31, -1.68178027712489818e-47,  3.98711713808685150e-64 },
+      {  5.73796581610397195e-32,  1.14165067651953677e-48,  6.96026038503407052e-65 },
+      { -9.40035936245687397e-33,  5.20401091475645424e-49,  1.51782377454518093e-65 },
+      { -1.35590280493486307e-33, -4.50894100403989015e-50,  4.58642936849184448e-66 },
+      {  2.44784384191528925e-34, -6.63581235610053540e-51, -4.89958432988037009e-67 },
+      {  3.20528849130720981e-35, -2.26072219266643690e-51,  1.03396503013059222e-67 },
+      { -6.33983878185254874e-36,  4.61221841537090220e-52,  1.29978687901662221e-68 },
+      { -7.57925545801218221e-37, -7.04198156290672911e-53, -2.47268741057437778e-69 }
+   };
+
+   /// Li5: coefficients zeta(-1-2k)/(6+2k)! of u^(6+2k) of Li5(e^u)
+   constexpr Triple li5_cs[] = {
+      { -1.15740740740740745e-04,  4.41711996197798138e-21, -3.56653693405043690e-37 },
+      {  2.06679894179894189e-07, -8.64399363500916261e-24, -2.44739167750566190e-40 },
+      { -1.09354441365023382e-09,  6.32418840487898064e-26,  7.48276373401196264e-43 },
+      {  8.69864874494504110e-12,  1.43174412259861216e-28,  7.09261637038696268e-45 },
+      { -8.68995878615888251e-14,  1.49501254503674676e-30,  8.05087240272239874e-47 },
+      {  1.00812540802188130e-15,  3.22996374988529388e-32,  7.63635294149716068e-49 },
+      { -1.30160058071551888e-17,  3.46059986503796606e-35, -1.05466525110234253e-51 },
+      {  1.82193858376471811e-19,  6.23846328451572536e-36,  2.96561633030143005e-52 },
+      { -2.71703945984843563e-21, -2.79248961850613148e-38,  2.90687188507448008e-55 },
+      {  4.26404710646461066e-23,  2.67923013914926400e-39, -1.19163577434163424e-55 },
+      { -6.97907523609028803e-25,  3.09928200075192990e-41, -2.10244687379171053e-57 },
+      {  1.18322350137468818e-26,  6.96334690401029683e-43,  1.50287036551454013e-59 },
+      { -2.06699310884539822e-28,  2.04016883984003213e-44, -7.29879695884447093e-61 },
+      {  3.70514089192917201e-30, -1.89631675474112734e-46, -2.24050496215568275e-63 },
+      { -6.79216396752655538e-32, -8.75728864889504890e-49, -7.29791620549777698e-65 },
+      {  1.26987457489641751e-33, -7.01478904207038353e-50,  2.31946722265631602e-66 },
+      { -2.41590408788077926e-35,  4.12723639333791246e-52, -3.68465685561776208e-68 },
+      {  4.66812326074215723e-37, -3.70194550084526748e-53,  1.57158274224685767e-69 }
+   };
+
+   /// Li6: coefficients of u^(k+1) of Li6(1 - e^(-u)), k = 0, ..., 44
+   constexpr Triple li6_bf[] = {
+      {  1.00000000000000000e+00,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      { -4.84375000000000000e-01,  0.00000000000000000e+00,  0.00000000000000000e+00 },
+      {  1.52413408779149523e-01, -3.00780586232466956e-18, -8.13698796805581131e-35 },
+      { -3.43655558770576131e-02, -1.14220475784481135e-19,  9.70890609824841110e-36 },
+      {  5.71747972393690015e-03, -2.84703749677865841e-19,  2.08045282535297353e-35 },
+      { -6.81804537465706428e-04, -1.93409055727212789e-20,  8.98397444291252986e-38 },
+      {  4.99603619487344960e-05, -2.91284219175196986e-21,  6.75420172924149220e-38 },
+      { -4.91660511960390517e-07,  3.97760541162532467e-23, -1.21296960619874145e-39 },
+      { -3.06329751613021634e-07, -4.15960997704217041e-24,  3.58809312261150578e-40 },
+      {  1.44145992708490948e-08,  5.69575895999923669e-25, -3.30040679498416283e-41 },
+      {  3.72724382309241028e-09,  3.82110581313377264e-25,  1.98302448440271433e-42 },
+      { -3.73008673454876070e-10, -2.56772382779743961e-27, -4.06256841447267788e-45 },
+      { -5.12465268160858347e-11,  2.30939764298843249e-27, -1.45234163338708894e-43 },
+      {  9.05419309566366799e-12,  2.96308135249274554e-28,  1.83915364147270204e-44 },
+      {  6.73818826155125190e-13, -1.95479491580197168e-29, -1.27808635501784275e-45 },
+      { -2.12158311503031365e-13,  1.17216686673975453e-29, -1.63253654208688870e-46 },
+      { -6.84088117190116960e-15, -1.66167085387964463e-31,  8.45286971913193989e-48 },
+      {  4.86911784620055806e-15,  6.96571448100656705e-32, -3.63787325147961358e-48 },
+      { -4.84398784998725076e-18,  3.44329782266339429e-34,  8.08459067769190921e-52 },
+      { -1.10271048491074908e-16, -1.60367814176093306e-33, -3.28011641535466451e-50 },
+      {  3.33537969169393835e-18, -1.83152497709257777e-34,  7.56750272326614083e-51 },
+      {  2.47353074886413542e-18, -1.23112116393738513e-34, -9.27532427735036925e-51 },
+      { -1.43706164342324926e-19,  5.44313152984076281e-36, -2.83702532884397568e-52 },
+      { -5.50471103350981179e-20, -1.94581802585870474e-37, -1.12631041887767954e-53 },
+      {  4.74677139173272286e-21, -3.66973064891633827e-37, -1.57988575208279176e-53 },
+      {  1.21583871780681059e-21, -7.02799345049177786e-38,  5.05191279383098277e-54 },
+      { -1.41075524035618501e-22,  1.99885329221528939e-40,  1.59369488219188986e-56 },
+      { -2.66388312532683450e-23, -1.57410237869597375e-39,  1.09545824512686519e-55 },
+      {  3.96676574286310094e-24, -1.41993270037686731e-40,  1.74705438153746523e-57 },
+      {  5.78216973585436154e-25, -6.60544173006121634e-43,  3.65671030155635462e-59 },
+      { -1.07877780631642581e-25,  7.56025042773992838e-42, -3.61012525061947584e-58 },
+      { -1.24073970867569095e-26, -3.51747368978398644e-43,  1.24978099821961270e-59 },
+      {  2.87041179178936014e-27,  2.55858107189338308e-44,  1.99737668834417138e-60 },
+      {  2.62355535630293294e-28,  1.20768506932341028e-44,  1.00549038032500946e-60 },
+      { -7.52294854657541316e-29,  4.35449590738280443e-45,  2.07923669958307201e-61 },
+      { -5.44017883796246979e-30,  1.74753109830954993e-46,  7.89371853485288943e-63 },
+      {  1.95025795325101680e-30, -1.64048916688655243e-46,  6.59879036917196088e-63 },
+      {  1.09784942822051883e-31, -2.58854920049785457e-48,  1.31843929203775712e-64 },
+      { -5.01495835741630089e-32, -2.82531275126580140e-49, -1.17471437351019501e-65 },
+      { -2.12867375043927621e-33,  1.00583389636297552e-49,  6.29263076091595717e-67 },
+      {  1.28159440165221257e-33,  2.62739689786732844e-50, -5.12556996901071544e-67 },
+      {  3.87108447330479440e-35,  1.32305769642596414e-52, -9.06330861103362526e-69 },
+      { -3.25941253155837592e-35, -6.70783640588051531e-53,  2.00597559580159916e-69 },
+      { -6.25269198847740604e-37,  2.32566434731299138e-53, -1.29087034476457764e-69 },
+      {  8.25794162051839866e-37, -6.43056482366300042e-53, -2.10775911834366677e-69 }
+   };
+
+   /// Li6: coefficients zeta(-1-2k)/(7+2k)! of u^(7+2k) of Li6(e^u)
+   constexpr Triple li6_cs[] = {
+      { -1.65343915343915355e-05,  1.11503596442788325e-21, -5.09505276292919572e-38 },
+      {  2.29644326866549102e-08, -1.32807956502458592e-24, -2.71932408611740228e-41 },
+      { -9.94131285136576199e-11,  5.74926218625361850e-27,  3.28921420758038330e-43 },
+      {  6.69126826534233923e-13,  1.87806621637039032e-29, -5.32336020989323701e-46 },
+      { -5.79330585743925516e-15,  2.57439684046652131e-31,  1.99641072718651098e-47 },
+      {  5.93014945895224272e-17,  4.07514661359340379e-33,  2.05914491604948513e-49 },
+      { -6.85052937218694125e-19, -1.84515784330035536e-35,  3.66506783114433952e-52 },
+      {  8.67589801792722996e-21, -5.62720473529267195e-37,  3.00312962757936895e-53 },
+      { -1.18132150428192846e-22, -8.36930892609485092e-39,  2.39605685343750776e-55 },
+      {  1.70561884258584422e-24,  1.51250243721806345e-40, -8.02919533136579962e-57 },
+      { -2.58484268003343985e-26, -4.46484030242188311e-43,  3.12878948816046688e-59 },
+      {  4.08008103922306312e-28, -1.92837494356553926e-44, -4.25950467842883528e-61 },
+      { -6.66771970595289734e-30,  5.22509451787931304e-46, -3.35816277347581998e-62 },
+      {  1.12276996725126409e-31,  9.51393818613995098e-48,  4.84575306354640304e-64 },
+      { -1.94061827643615855e-33, -1.52091695499511960e-49,  2.79831592481996004e-66 },
+      {  3.43209344566599321e-35, -1.31799385783692618e-51,  1.85788247663202851e-68 },
+      { -6.19462586636097267e-37,  2.98574029242877253e-53, -1.30143824669885770e-69 }
+   };
+
+} // namespace constants
+
+   /**
+    * Real dilogarithm.  The argument is mapped to y in [0, 1/2], where
+    * the series in u = -log(1 - y) with Bernoulli coefficients is
+    * summed.
+    */
+   template <typename T>
+   T li2(const T& x) noexcept
+   {
+      static const T zeta2 = to<T>(constants::zeta2);
+      static const Table<T, 23> bf(constants::li2_bf);
+
+      T y(0), r(0), s(1);
+
+      // transform to [0, 1/2]
+      if (x < T(-1)) {
+         const T l = Real<T>::log(T(1) - x);
+         y = T(1)/(T(1) - x);
+         r = -zeta2 + l*(T(0.5)*l - Real<T>::log(-x));
+         s = T(1);
+      } else if (x == T(-1)) {
+         return T(-0.5)*zeta2;
+      } else if (x < T(0)) {
+         const T l = Real<T>::log1p(-x);
+         y = x/(x - T(1));
+         r = T(-0.5)*l*l;
+         s = T(-1);
+      } else if (x == T(0)) {
+         return x;
+      } else if (x < T(0.5)) {
+         y = x;
+         r = T(0);
+         s = T(1);
+      } else if (x < T(1)) {
+         y = T(1) - x;
+         r = zeta2 - Real<T>::log(x)*Real<T>::log1p(-x);
+         s = T(-1);
+      } else if (x == T(1)) {
+         return zeta2;
+      } else if (x < T(2)) {
+         const T l = Real<T>::log(x);
+         y = T(1) - T(1)/x;
+         r = zeta2 - l*(Real<T>::log(y) + T(0.5)*l);
+         s = T(1);
+      } else {
+         const T l = Real<T>::log(x);
+         y = T(1)/x;
+         r = T(2)*zeta2 - T(0.5)*l*l;
+         s = T(-1);
+      }
+
+      const T u = -Real<T>::log1p(-y);
+      const T u2 = u*u;
+
+      return r + s*(u + u2*(bf.c[0] + u*horner(u2, bf.c + 1, terms<T>(11, 23) - 1)));
+   }
+
+   /// complex dilogarithm for Im(z) != 0
+   template <typename T>
+   Complex<T> li2(const Complex<T>& z) noexcept
+   {
+      static const T zeta2 = to<T>(constants::zeta2);
+      static const Table<T, 23> bf(constants::li2_bf);
+
+      const T nz = norm_sqr(z);
+
+      if (nz < Real<T>::eps()) {
+         return z*(T(1) + T(0.25)*z);
+      }
+
+      Complex<T> u, rest;
+      T sgn(1);
+
+      // transformation to |z|<1, Re(z)<=0.5
+      if (z.re <= T(0.5)) {
+         if (nz > T(1)) {
+            const Complex<T> lz = clog(-z);
+            u = -clog1p(-(T(1)/z));
+            rest = T(-0.5)*lz*lz - zeta2;
+            sgn = T(-1);
+         } else { // nz <= 1
+            u = -clog1p(-z);
+         }
+      } else { // z.re > 0.5
+         if (nz <= T(2)*z.re) {
+            u = -clog(z);
+            rest = u*clog1p(-z) + zeta2;
+            sgn = T(-1);
+         } else { // nz > 2*z.re
+            const Complex<T> lz = clog(-z);
+            u = -clog1p(-(T(1)/z));
+            rest = T(-0.5)*lz*lz - zeta2;
+            sgn = T(-1);
+         }
+      }
+
+      const Complex<T> u2(u*u);
+
+      return sgn*(u + u2*(bf.c[0] + u*horner(u2, bf.c + 1, terms<T>(11, 23) - 1))) + rest;
+   }
+
+   /// complex trilogarithm
+   template <typename T>
+   Complex<T> li3(const Complex<T>& z) noexcept
+   {
+      static const T PI = to<T>(constants::pi);
+      static const T zeta2 = to<T>(constants::zeta2);
+      static const T zeta3 = to<T>(constants::zeta3);
+      static const Table<T, 45> bf(constants::li3_bf);
+      static const Table<T, 20> cs(constants::li3_cs);
+
+      if (z.im == T(0)) {
+         if (z.re == T(0)) {
+            return Complex<T>();
+         }
+         if (z.re == T(1)) {
+            return zeta3;
+         }
+         if (z.re == T(-1)) {
+            return T(-0.75)*zeta3;
+         }
+         if (z.re == T(0.5)) {
+            return to<T>(constants::li3_half);
+         }
+      }
+
+      const T nz  = modulus(z);
+      const T pz  = phase(z);
+      const T lnz = log_abs(z);
+
+      if (lnz*lnz + pz*pz < T(1)) { // |log(z)| < 1
+         const Complex<T> u(lnz, pz); // log(z)
+         const Complex<T> u2 = u*u;
+         const Complex<T> c0 = zeta3 + u*(zeta2 - u2/T(12));
+         const Complex<T> c1 = T(0.25)*(T(3) - T(2)*clog(-u));
+
+         return c0 + u2*(c1 + u2*horner(u2, cs.c, terms<T>(9, 20)));
+      }
+
+      Complex<T> u, rest;
+
+      if (nz <= T(1)) {
+         u = -clog1p(-z);
+      } else { // nz > 1
+         const Complex<T> lmz = log_neg(pz, lnz, PI); // log(-z)
+         u = -clog1p(-(T(1)/z));
+         rest = -lmz*(lmz*lmz/T(6) + zeta2);
+      }
+
+      return rest + u*horner(u, bf.c, terms<T>(22, 45));
+   }
+
+   /// complex polylogarithm of order 4
+   template <typename T>
+   Complex<T> li4(const Complex<T>& z) noexcept
+   {
+      static const T PI = to<T>(constants::pi);
+      static const T PI2 = PI*PI;
+      static const T PI4 = PI2*PI2;
+      static const T zeta2 = to<T>(constants::zeta2);
+      static const T zeta3 = to<T>(constants::zeta3);
+      static const T zeta4 = to<T>(constants::zeta4);
+      static const Table<T, 45> bf(constants::li4_bf);
+      static const Table<T, 19> cs(constants::li4_cs);
+
+      if (z.im == T(0)) {
+         if (z.re == T(0)) {
+            return Complex<T>();
+         }
+         if (z.re == T(1)) {
+            return zeta4;
+         }
+         if (z.re == T(-1)) {
+            return T(-7)*PI4/T(720);
+         }
+      }
+
+      const T nz  = modulus(z);
+      const T pz  = phase(z);
+      const T lnz = log_abs(z);
+
+      if (lnz*lnz + pz*pz < T(1)) { // |log(z)| < 1
+         const Complex<T> u(lnz, pz); // log(z)
+         const Complex<T> u2 = u*u;
+         const T c1 = zeta3;
+         const T c2 = T(0.5)*zeta2;
+         const Complex<T> c3 = (T(11)/T(6) - clog(-u))/T(6);
+         const T c4 = T(-1)/T(48);
+
+         return zeta4 + u2*(c2 + u2*c4) +
+            u*(c1 + u2*(c3 + u2*horner(u2, cs.c, terms<T>(8, 19))));
+      }
+
+      Complex<T> u, rest;
+      T sgn(1);
+
+      if (nz <= T(1)) {
+         u = -clog1p(-z);
+      } else { // nz > 1
+         const Complex<T> lmz = log_neg(pz, lnz, PI); // log(-z)
+         const Complex<T> lmz2 = lmz*lmz;
+         u = -clog1p(-(T(1)/z));
+         rest = (T(-7)*PI4 + lmz2*(T(-30)*PI2 - T(15)*lmz2))/T(360);
+         sgn = T(-1);
+      }
+
+      return rest + sgn*u*horner(u, bf.c, terms<T>(22, 45));
+   }
+
+   /// complex polylogarithm of order 5
+   template <typename T>
+   Complex<T> li5(const Complex<T>& z) noexcept
+   {
+      static const T PI = to<T>(constants::pi);
+      static const T PI2 = PI*PI;
+      static const T PI4 = PI2*PI2;
+      static const T zeta2 = to<T>(constants::zeta2);
+      static const T zeta3 = to<T>(constants::zeta3);
+      static const T zeta4 = to<T>(constants::zeta4);
+      static const T zeta5 = to<T>(constants::zeta5);
+      static const Table<T, 45> bf(constants::li5_bf);
+      static const Table<T, 18> cs(constants::li5_cs);
+
+      if (z.im == T(0)) {
+         if (z.re == T(0)) {
+            return Complex<T>();
+         }
+         if (z.re == T(1)) {
+            return zeta5;
+         }
+         if (z.re == T(-1)) {
+            return T(-15)*zeta5/T(16);
+         }
+      }
+
+      const T nz  = modulus(z);
+      const T pz  = phase(z);
+      const T lnz = log_abs(z);
+
+      if (lnz*lnz + pz*pz < T(1)) { // |log(z)| < 1
+         const Complex<T> u(lnz, pz); // log(z)
+         const Complex<T> u2 = u*u;
+         const T c0 = zeta5;
+         const T c1 = zeta4;
+         const T c2 = T(0.5)*zeta3;
+         const T c3 = zeta2/T(6);
+         const Complex<T> c4 = (T(25)/T(12) - clog(-u))/T(24);
+         const T c5 = T(-1)/T(240);
+
+         return c0 + u * c1 +
+            u2 * (c2 + u * c3 +
+            u2 * (c4 + u * c5 +
+            u2 * horner(u2, cs.c, terms<T>(7, 18))));
+      }
+
+      Complex<T> u, rest;
+
+      if (nz <= T(1)) {
+         u = -clog1p(-z);
+      } else { // nz > 1
+         const Complex<T> lmz = log_neg(pz, lnz, PI); // log(-z)
+         const Complex<T> lmz2 = lmz*lmz;
+         u = -clog1p(-(T(1)/z));
+         rest = -lmz*(T(7)*PI4 + lmz2*(T(10)*PI2 + T(3)*lmz2))/T(360);
+      }
+
+      return rest + u*horner(u, bf.c, terms<T>(21, 45));
+   }
+
+   /// complex polylogarithm of order 6
+   template <typename T>
+   Complex<T> li6(const Complex<T>& z) noexcept
+   {
+      static const T PI = to<T>(constants::pi);
+      static const T PI2 = PI*PI;
+      static const T PI4 = PI2*PI2;
+      static const T PI6 = PI2*PI4;
+      static const T zeta2 = to<T>(constants::zeta2);
+      static const T zeta3 = to<T>(constants::zeta3);
+      static const T zeta4 = to<T>(constants::zeta4);
+      static const T zeta5 = to<T>(constants::zeta5);
+      static const T zeta6 = to<T>(constants::zeta6);
+      static const Table<T, 45> bf(constants::li6_bf);
+      static const Table<T, 17> cs(constants::li6_cs);
+
+      if (z.im == T(0)) {
+         if (z.re == T(0)) {
+            return Complex<T>();
+         }
+         if (z.re == T(1)) {
+            return zeta6;
+         }
+         if (z.re == T(-1)) {
+            return T(-31)*zeta6/T(32);
+         }
+      }
+
+      const T nz  = modulus(z);
+      const T pz  = phase(z);
+      const T lnz = log_abs(z);
+
+      if (lnz*lnz + pz*pz < T(1)) { // |log(z)| < 1
+         const Complex<T> u(lnz, pz); // log(z)
+         const Complex<T> u2 = u*u;
+         const T c0 = zeta6;
+         const T c1 = zeta5;
+         const T c2 = T(0.5)*zeta4;
+         const T c3 = zeta3/T(6);
+         const T c4 = zeta2/T(24);
+         const Complex<T> c5 = (T(137)/T(60) - clog(-u))/T(120);
+         const T c6 = T(-1)/T(1440);
+
+         return c0 + u * c1 +
+            u2 * (c2 + u * c3 +
+            u2 * (c4 + u * c5 +
+            u2 * (c6 +
+            u * horner(u2, cs.c, terms<T>(6, 17)))));
+      }
+
+      Complex<T> u, rest;
+      T sgn(1);
+
+      if (nz <= T(1)) {
+         u = -clog1p(-z);
+      } else { // nz > 1
+         const Complex<T> lmz = log_neg(pz, lnz, PI); // log(-z)
+         const Complex<T> lmz2 = lmz*lmz;
+         u = -clog1p(-(T(1)/z));
+         rest = T(-31)*PI6/T(15120)
+                + lmz2*(T(-7)/T(720)*PI4 +
+                        lmz2*(T(-1)/T(144)*PI2 - lmz2/T(720)));
+         sgn = T(-1);
+      }
+
+      return rest + sgn*u*horner(u, bf.c, terms<T>(22, 45));
+   }
+
+} // namespace li_kernel
+} // namespace detail
+} // namespace polylogarithm
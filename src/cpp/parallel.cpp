@@ -0,0 +1,192 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "parallel.hpp"
+
+namespace polylogarithm {
+namespace parallel {
+
+/**
+ * @brief Creates a thread pool
+ * @param n_threads number of threads, which execute a job, including
+ * the thread calling run().  If 0, one thread is used.
+ */
+POLYLOGARITHM_INLINE ThreadPool::ThreadPool(std::size_t n_threads)
+{
+   if (n_threads == 0) {
+      n_threads = 1;
+   }
+
+   queues.reserve(n_threads);
+   for (std::size_t i = 0; i < n_threads; ++i) {
+      queues.emplace_back(new Queue);
+   }
+
+   workers.reserve(n_threads - 1);
+   for (std::size_t i = 1; i < n_threads; ++i) {
+      workers.emplace_back(&ThreadPool::work, this, i);
+   }
+}
+
+POLYLOGARITHM_INLINE ThreadPool::~ThreadPool()
+{
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+   }
+   job_cv.notify_all();
+
+   for (auto& w: workers) {
+      w.join();
+   }
+}
+
+/**
+ * @brief Executes task(i) for all i in [0, n_tasks)
+ * @param n_tasks number of tasks
+ * @param task function to be called for each task index
+ *
+ * The function returns after all tasks have finished.  If one of the
+ * tasks throws an exception, the remaining tasks are still executed
+ * and the first exception is re-thrown afterwards.
+ */
+POLYLOGARITHM_INLINE void ThreadPool::run(std::size_t n_tasks, const std::function<void(std::size_t)>& task)
+{
+   if (n_tasks == 0) {
+      return;
+   }
+
+   std::lock_guard<std::mutex> run_lock(run_mutex);
+
+   const std::size_t n_threads = size();
+
+   for (std::size_t i = 0; i < n_threads; ++i) {
+      std::lock_guard<std::mutex> lock(queues[i]->mutex);
+      queues[i]->begin = i*n_tasks/n_threads;
+      queues[i]->end = (i + 1)*n_tasks/n_threads;
+   }
+
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      this->task = &task;
+      error = nullptr;
+      n_busy = n_threads - 1;
+      generation++;
+   }
+   job_cv.notify_all();
+
+   execute(0);
+
+   std::exception_ptr err;
+
+   {
+      std::unique_lock<std::mutex> lock(mutex);
+      done_cv.wait(lock, [this] { return n_busy == 0; });
+      this->task = nullptr;
+      err = error;
+   }
+
+   if (err) {
+      std::rethrow_exception(err);
+   }
+}
+
+/// main loop of the worker thread with index id
+POLYLOGARITHM_INLINE void ThreadPool::work(std::size_t id)
+{
+   std::size_t seen = 0;
+
+   while (true) {
+      {
+         std::unique_lock<std::mutex> lock(mutex);
+         job_cv.wait(lock, [this, seen] { return stop || generation != seen; });
+         if (stop) {
+            return;
+         }
+         seen = generation;
+      }
+
+      execute(id);
+
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         if (--n_busy == 0) {
+            done_cv.notify_one();
+         }
+      }
+   }
+}
+
+/// executes tasks of the current job on thread id until no task is left
+POLYLOGARITHM_INLINE void ThreadPool::execute(std::size_t id)
+{
+   std::size_t i = 0;
+
+   while (true) {
+      if (!pop(id, i)) {
+         if (!steal(id)) {
+            break;
+         }
+         continue;
+      }
+      try {
+         (*task)(i);
+      } catch (...) {
+         std::lock_guard<std::mutex> lock(mutex);
+         if (!error) {
+            error = std::current_exception();
+         }
+      }
+   }
+}
+
+/// takes the next task index from the front of the queue of thread id
+POLYLOGARITHM_INLINE bool ThreadPool::pop(std::size_t id, std::size_t& i)
+{
+   Queue& q = *queues[id];
+   std::lock_guard<std::mutex> lock(q.mutex);
+
+   if (q.begin < q.end) {
+      i = q.begin++;
+      return true;
+   }
+
+   return false;
+}
+
+/// moves the back half of the queue of another thread to thread id
+POLYLOGARITHM_INLINE bool ThreadPool::steal(std::size_t id)
+{
+   const std::size_t n_threads = size();
+
+   for (std::size_t k = 1; k < n_threads; ++k) {
+      Queue& victim = *queues[(id + k) % n_threads];
+      std::size_t begin = 0, end = 0;
+
+      {
+         std::lock_guard<std::mutex> lock(victim.mutex);
+         const std::size_t remaining = victim.end - victim.begin;
+         if (remaining == 0) {
+            continue;
+         }
+         end = victim.end;
+         begin = end - (remaining + 1)/2;
+         victim.end = begin;
+      }
+
+      Queue& own = *queues[id];
+      std::lock_guard<std::mutex> lock(own.mutex);
+      own.begin = begin;
+      own.end = end;
+
+      return true;
+   }
+
+   return false;
+}
+
+} // namespace parallel
+} // namespace polylogarithm
@@ -0,0 +1,122 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace polylogarithm {
+namespace parallel {
+
+/**
+ * Pool of threads, which execute a set of independent tasks with
+ * work stealing.
+ *
+ * The tasks of a job are distributed as contiguous ranges among the
+ * threads.  Each thread processes its own range from the front.  A
+ * thread that has run out of tasks steals the back half of the range
+ * of another thread.  The thread that calls run() participates in the
+ * execution of the job.
+ */
+class ThreadPool {
+public:
+   /// creates a pool, which executes jobs with n_threads threads
+   explicit ThreadPool(std::size_t n_threads = std::thread::hardware_concurrency());
+   ~ThreadPool();
+
+   ThreadPool(const ThreadPool&) = delete;
+   ThreadPool& operator=(const ThreadPool&) = delete;
+
+   /// returns the number of threads, which execute a job
+   std::size_t size() const noexcept { return queues.size(); }
+
+   /// calls task(i) for all i in [0, n_tasks) and waits until all calls have finished
+   void run(std::size_t n_tasks, const std::function<void(std::size_t)>& task);
+
+private:
+   /// range of task indices [begin, end) owned by one thread
+   struct Queue {
+      std::mutex mutex;
+      std::size_t begin{0};
+      std::size_t end{0};
+   };
+
+   std::vector<std::thread> workers;
+   std::vector<std::unique_ptr<Queue>> queues;
+   std::mutex run_mutex;                       ///< serializes calls to run()
+   std::mutex mutex;                           ///< protects the job state below
+   std::condition_variable job_cv;
+   std::condition_variable done_cv;
+   const std::function<void(std::size_t)>* task{nullptr};
+   std::exception_ptr error;
+   std::size_t generation{0};
+   std::size_t n_busy{0};
+   bool stop{false};
+
+   void work(std::size_t);
+   void execute(std::size_t);
+   bool pop(std::size_t, std::size_t&);
+   bool steal(std::size_t);
+};
+
+/**
+ * @brief Evaluates out[i] = fn(in[i]) for i = 0, ..., n - 1 in parallel
+ * @param fn function to evaluate, e.g. Li2 or a lambda calling Li(n, z)
+ * @param in array of arguments
+ * @param out array of size n, filled with the function values
+ * @param n number of elements
+ * @param pool thread pool
+ * @param chunk number of elements processed by one task (0 = automatic)
+ *
+ * The elements are split into chunks, which are distributed among the
+ * threads of the pool with work stealing, so that arguments with very
+ * different evaluation cost do not lead to a load imbalance.
+ */
+template <typename Fn, typename T, typename U>
+void evaluate(Fn fn, const T* in, U* out, std::size_t n, ThreadPool& pool, std::size_t chunk = 0)
+{
+   if (n == 0) {
+      return;
+   }
+
+   if (chunk == 0) {
+      // aim for 16 chunks per thread
+      chunk = n/(16*pool.size());
+      chunk = chunk < 16 ? 16 : (chunk > 4096 ? 4096 : chunk);
+   }
+
+   const std::size_t n_tasks = (n + chunk - 1)/chunk;
+
+   pool.run(n_tasks, [&](std::size_t t) {
+      const std::size_t first = t*chunk;
+      const std::size_t last = first + chunk < n ? first + chunk : n;
+      for (std::size_t i = first; i < last; ++i) {
+         out[i] = fn(in[i]);
+      }
+   });
+}
+
+/// evaluates out[i] = fn(in[i]) in parallel for vectors
+template <typename Fn, typename T, typename U>
+void evaluate(Fn fn, const std::vector<T>& in, std::vector<U>& out, ThreadPool& pool)
+{
+   out.resize(in.size());
+   evaluate(fn, in.data(), out.data(), in.size(), pool);
+}
+
+} // namespace parallel
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "parallel.cpp"
+#endif
@@ -0,0 +1,78 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#include "trig_sum.hpp"
+#include "inv_pow.hpp"
+#include <cmath>
+
+namespace polylogarithm {
+namespace detail {
+namespace trig {
+
+// returns sum_{k=1}^{kmax} w[k-1]*sin(k*x) for sine = true and
+// sum_{k=1}^{kmax} w[k-1]*cos(k*x) for sine = false, where co = cos(x)
+// and si = sin(x)
+POLYLOGARITHM_INLINE double trig_sum(const std::vector<double>& w, bool sine, double co, double si) noexcept
+{
+   const std::size_t kmax = w.size();
+   double sum = 0;
+
+   if (sine) {
+      double si2 = 0;  // sin((k-2)*x)
+      double si1 = si; // sin((k-1)*x)
+      sum = w[0]*si;
+      for (std::size_t k = 2; k <= kmax; ++k) {
+         si = 2*co*si1 - si2; // sin(k*x)
+         si2 = si1;
+         si1 = si;
+         sum += w[k - 1]*si;
+      }
+   } else {
+      double co2 = 1;  // cos((k-2)*x)
+      double co1 = co; // cos((k-1)*x)
+      sum = w[0]*co;
+      for (std::size_t k = 2; k <= kmax; ++k) {
+         const double con = 2*co*co1 - co2; // cos(k*x)
+         co2 = co1;
+         co1 = con;
+         sum += w[k - 1]*con;
+      }
+   }
+
+   return sum;
+}
+
+// evaluates the series of the order n on the grid x0 + j*h, where
+// cos(x) and sin(x) are obtained by rotation from the previous grid
+// point and re-computed every GRID_RESEED points to limit the
+// accumulation of round-off errors
+POLYLOGARITHM_INLINE void series_grid(int64_t n, bool sine, double x0, double h, std::size_t count, double* out)
+{
+   const auto table = inv_pow(n);
+   const auto& w = *table; // w[k - 1] = k^(-n)
+
+   // cos(h) - 1 = -2*sin(h/2)^2, which is accurate for small h
+   const double sh2 = std::sin(h/2);
+   const double cm = -2*sh2*sh2, sh = std::sin(h);
+   double co = 0, si = 0;
+
+   for (std::size_t j = 0; j < count; ++j) {
+      if (j % GRID_RESEED == 0) {
+         const double x = x0 + j*h;
+         co = std::cos(x);
+         si = std::sin(x);
+      } else {
+         const double c = co + (co*cm - si*sh);
+         si = si + (si*cm + co*sh);
+         co = c;
+      }
+      out[j] = trig_sum(w, sine, co, si);
+   }
+}
+
+} // namespace trig
+} // namespace detail
+} // namespace polylogarithm
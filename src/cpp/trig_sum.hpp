@@ -0,0 +1,35 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "config.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace polylogarithm {
+namespace detail {
+namespace trig {
+
+/// re-compute cos/sin on the grid every GRID_RESEED points
+constexpr std::size_t GRID_RESEED = 32;
+
+/// returns sum_{k=1}^{kmax} w[k-1]*sin(k*x) for sine = true and
+/// sum_{k=1}^{kmax} w[k-1]*cos(k*x) for sine = false, where co = cos(x)
+/// and si = sin(x)
+double trig_sum(const std::vector<double>& w, bool sine, double co, double si) noexcept;
+
+/// evaluates the sine (cosine) series with weights k^(-n) on the grid
+/// x0 + j*h for j = 0, ..., count - 1
+void series_grid(int64_t n, bool sine, double x0, double h, std::size_t count, double* out);
+
+} // namespace trig
+} // namespace detail
+} // namespace polylogarithm
+
+#ifdef POLYLOGARITHM_HEADER_ONLY
+#include "trig_sum.cpp"
+#endif
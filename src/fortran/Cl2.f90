@@ -86,3 +86,24 @@ double precision function dcl2(x)
   dcl2 = sgn*h
 
 end function dcl2
+
+
+!*********************************************************************
+!> @brief Clausen function \f$\operatorname{Cl}_2(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Cl_2(x(i))
+!*********************************************************************
+
+subroutine dcl2_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dcl2, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl2(t)
+  end do
+
+end subroutine dcl2_v
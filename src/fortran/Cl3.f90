@@ -83,3 +83,24 @@ double precision function dcl3(x)
   dcl3 = h
 
 end function dcl3
+
+
+!*********************************************************************
+!> @brief Clausen function \f$\operatorname{Cl}_3(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Cl_3(x(i))
+!*********************************************************************
+
+subroutine dcl3_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dcl3, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl3(t)
+  end do
+
+end subroutine dcl3_v
@@ -87,3 +87,24 @@ double precision function dcl4(x)
   dcl4 = sgn*h
 
 end function dcl4
+
+
+!*********************************************************************
+!> @brief Clausen function \f$\operatorname{Cl}_4(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Cl_4(x(i))
+!*********************************************************************
+
+subroutine dcl4_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dcl4, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl4(t)
+  end do
+
+end subroutine dcl4_v
@@ -84,3 +84,24 @@ double precision function dcl5(x)
   dcl5 = h
 
 end function dcl5
+
+
+!*********************************************************************
+!> @brief Clausen function \f$\operatorname{Cl}_5(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Cl_5(x(i))
+!*********************************************************************
+
+subroutine dcl5_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dcl5, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl5(t)
+  end do
+
+end subroutine dcl5_v
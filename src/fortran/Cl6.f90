@@ -86,3 +86,24 @@ double precision function dcl6(x)
   dcl6 = sgn*h
 
 end function dcl6
+
+
+!*********************************************************************
+!> @brief Clausen function \f$\operatorname{Cl}_6(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Cl_6(x(i))
+!*********************************************************************
+
+subroutine dcl6_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dcl6, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl6(t)
+  end do
+
+end subroutine dcl6_v
@@ -166,3 +166,43 @@ double complex function cdli2(z)
   cdli2 = sgn*sum + rest
 
 end function cdli2
+
+
+!*********************************************************************
+!> @brief Real dilogarithm \f$\operatorname{Li}_2(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Li_2(x(i))
+!*********************************************************************
+
+subroutine dli2_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dli2, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dli2(t)
+  end do
+
+end subroutine dli2_v
+
+
+!*********************************************************************
+!> @brief Complex dilogarithm \f$\operatorname{Li}_2(z)\f$ for an array of arguments
+!> @param n number of elements
+!> @param z array of complex arguments
+!> @param res array of results, res(i) = Li_2(z(i))
+!*********************************************************************
+
+subroutine cdli2_v(n, z, res)
+  implicit none
+  integer :: n, i
+  double complex :: z(n), res(n), cdli2
+
+  do i = 1, n
+     res(i) = cdli2(z(i))
+  end do
+
+end subroutine cdli2_v
@@ -192,3 +192,43 @@ double complex function cdli3(z)
       u8*u8*(bf(16) + u*bf(17) + u2*bf(18))
 
 end function cdli3
+
+
+!*********************************************************************
+!> @brief Real trilogarithm \f$\operatorname{Li}_3(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Li_3(x(i))
+!*********************************************************************
+
+subroutine dli3_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dli3, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dli3(t)
+  end do
+
+end subroutine dli3_v
+
+
+!*********************************************************************
+!> @brief Complex trilogarithm \f$\operatorname{Li}_3(z)\f$ for an array of arguments
+!> @param n number of elements
+!> @param z array of complex arguments
+!> @param res array of results, res(i) = Li_3(z(i))
+!*********************************************************************
+
+subroutine cdli3_v(n, z, res)
+  implicit none
+  integer :: n, i
+  double complex :: z(n), res(n), cdli3
+
+  do i = 1, n
+     res(i) = cdli3(z(i))
+  end do
+
+end subroutine cdli3_v
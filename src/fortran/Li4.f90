@@ -252,3 +252,43 @@ double complex function cdli4(z)
       )
 
 end function cdli4
+
+
+!*********************************************************************
+!> @brief Real polylogarithm \f$\operatorname{Li}_4(x)\f$ for an array of arguments
+!> @param n number of elements
+!> @param x array of real arguments
+!> @param res array of results, res(i) = Li_4(x(i))
+!*********************************************************************
+
+subroutine dli4_v(n, x, res)
+  implicit none
+  integer :: n, i
+  double precision :: x(n), res(n), dli4, t
+
+  ! pass a copy, because the function may modify its argument
+  do i = 1, n
+     t = x(i)
+     res(i) = dli4(t)
+  end do
+
+end subroutine dli4_v
+
+
+!*********************************************************************
+!> @brief Complex polylogarithm \f$\operatorname{Li}_4(z)\f$ for an array of arguments
+!> @param n number of elements
+!> @param z array of complex arguments
+!> @param res array of results, res(i) = Li_4(z(i))
+!*********************************************************************
+
+subroutine cdli4_v(n, z, res)
+  implicit none
+  integer :: n, i
+  double complex :: z(n), res(n), cdli4
+
+  do i = 1, n
+     res(i) = cdli4(z(i))
+  end do
+
+end subroutine cdli4_v
@@ -106,3 +106,22 @@ double complex function cdli5(z)
       u8*u8*(bf(16) + u*bf(17) + u2*(bf(18) + u*bf(19)))
 
 end function cdli5
+
+
+!*********************************************************************
+!> @brief Complex polylogarithm \f$\operatorname{Li}_5(z)\f$ for an array of arguments
+!> @param n number of elements
+!> @param z array of complex arguments
+!> @param res array of results, res(i) = Li_5(z(i))
+!*********************************************************************
+
+subroutine cdli5_v(n, z, res)
+  implicit none
+  integer :: n, i
+  double complex :: z(n), res(n), cdli5
+
+  do i = 1, n
+     res(i) = cdli5(z(i))
+  end do
+
+end subroutine cdli5_v
@@ -109,3 +109,22 @@ double complex function cdli6(z)
       )
 
 end function cdli6
+
+
+!*********************************************************************
+!> @brief Complex polylogarithm \f$\operatorname{Li}_6(z)\f$ for an array of arguments
+!> @param n number of elements
+!> @param z array of complex arguments
+!> @param res array of results, res(i) = Li_6(z(i))
+!*********************************************************************
+
+subroutine cdli6_v(n, z, res)
+  implicit none
+  integer :: n, i
+  double complex :: z(n), res(n), cdli6
+
+  do i = 1, n
+     res(i) = cdli6(z(i))
+  end do
+
+end subroutine cdli6_v
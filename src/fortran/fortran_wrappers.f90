@@ -143,3 +143,203 @@ subroutine cli6_fortran(re, im, res_re, res_im) bind(C)
   res_re = real(res)
   res_im = aimag(res)
 end subroutine cli6_fortran
+
+
+subroutine cl2_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dcl2
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl2(t)
+  end do
+end subroutine cl2_fortran_v
+
+
+subroutine cl3_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dcl3
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl3(t)
+  end do
+end subroutine cl3_fortran_v
+
+
+subroutine cl4_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dcl4
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl4(t)
+  end do
+end subroutine cl4_fortran_v
+
+
+subroutine cl5_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dcl5
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl5(t)
+  end do
+end subroutine cl5_fortran_v
+
+
+subroutine cl6_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dcl6
+  do i = 1, n
+     t = x(i)
+     res(i) = dcl6(t)
+  end do
+end subroutine cl6_fortran_v
+
+
+subroutine li2_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dli2
+  do i = 1, n
+     t = x(i)
+     res(i) = dli2(t)
+  end do
+end subroutine li2_fortran_v
+
+
+subroutine li3_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dli3
+  do i = 1, n
+     t = x(i)
+     res(i) = dli3(t)
+  end do
+end subroutine li3_fortran_v
+
+
+subroutine li4_fortran_v(x, res, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: x(n)
+  real(c_double), intent(out) :: res(n)
+  integer(c_size_t) :: i
+  double precision t, dli4
+  do i = 1, n
+     t = x(i)
+     res(i) = dli4(t)
+  end do
+end subroutine li4_fortran_v
+
+
+subroutine cli2_fortran_v(re, im, res_re, res_im, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: im(n), re(n)
+  real(c_double), intent(out) :: res_re(n), res_im(n)
+  integer(c_size_t) :: i
+  double complex res, cdli2
+  do i = 1, n
+     res = cdli2(dcmplx(re(i), im(i)))
+     res_re(i) = real(res)
+     res_im(i) = aimag(res)
+  end do
+end subroutine cli2_fortran_v
+
+
+subroutine cli3_fortran_v(re, im, res_re, res_im, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: im(n), re(n)
+  real(c_double), intent(out) :: res_re(n), res_im(n)
+  integer(c_size_t) :: i
+  double complex res, cdli3
+  do i = 1, n
+     res = cdli3(dcmplx(re(i), im(i)))
+     res_re(i) = real(res)
+     res_im(i) = aimag(res)
+  end do
+end subroutine cli3_fortran_v
+
+
+subroutine cli4_fortran_v(re, im, res_re, res_im, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: im(n), re(n)
+  real(c_double), intent(out) :: res_re(n), res_im(n)
+  integer(c_size_t) :: i
+  double complex res, cdli4
+  do i = 1, n
+     res = cdli4(dcmplx(re(i), im(i)))
+     res_re(i) = real(res)
+     res_im(i) = aimag(res)
+  end do
+end subroutine cli4_fortran_v
+
+
+subroutine cli5_fortran_v(re, im, res_re, res_im, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: im(n), re(n)
+  real(c_double), intent(out) :: res_re(n), res_im(n)
+  integer(c_size_t) :: i
+  double complex res, cdli5
+  do i = 1, n
+     res = cdli5(dcmplx(re(i), im(i)))
+     res_re(i) = real(res)
+     res_im(i) = aimag(res)
+  end do
+end subroutine cli5_fortran_v
+
+
+subroutine cli6_fortran_v(re, im, res_re, res_im, n) bind(C)
+  use, intrinsic :: iso_c_binding
+  implicit none
+  integer(c_size_t), value    :: n
+  real(c_double), intent(in)  :: im(n), re(n)
+  real(c_double), intent(out) :: res_re(n), res_im(n)
+  integer(c_size_t) :: i
+  double complex res, cdli6
+  do i = 1, n
+     res = cdli6(dcmplx(re(i), im(i)))
+     res_re(i) = real(res)
+     res_im(i) = aimag(res)
+  end do
+end subroutine cli6_fortran_v
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -45,6 +47,51 @@ void cli5_fortran(const double* re, const double* im, double* res_re, double* re
 /** complex polylogarithm with n=6, Fortran implementation */
 void cli6_fortran(const double* re, const double* im, double* res_re, double* res_im);
 
+/*
+ * Batch versions: evaluate the function for the n arguments x[i]
+ * (complex: re[i] + i*im[i]) and write the results to res[i]
+ * (complex: res_re[i] + i*res_im[i]).
+ */
+
+/** Clausen function with n=2 for an array of arguments, Fortran implementation */
+void cl2_fortran_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=3 for an array of arguments, Fortran implementation */
+void cl3_fortran_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=4 for an array of arguments, Fortran implementation */
+void cl4_fortran_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=5 for an array of arguments, Fortran implementation */
+void cl5_fortran_v(const double* x, double* res, size_t n);
+
+/** Clausen function with n=6 for an array of arguments, Fortran implementation */
+void cl6_fortran_v(const double* x, double* res, size_t n);
+
+/** real polylogarithm with n=2 (dilogarithm) for an array of arguments, Fortran implementation */
+void li2_fortran_v(const double* x, double* res, size_t n);
+
+/** real polylogarithm with n=3 (trilogarithm) for an array of arguments, Fortran implementation */
+void li3_fortran_v(const double* x, double* res, size_t n);
+
+/** real polylogarithm with n=4 for an array of arguments, Fortran implementation */
+void li4_fortran_v(const double* x, double* res, size_t n);
+
+/** complex polylogarithm with n=2 (dilogarithm) for an array of arguments, Fortran implementation */
+void cli2_fortran_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=3 (trilogarithm) for an array of arguments, Fortran implementation */
+void cli3_fortran_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=4 for an array of arguments, Fortran implementation */
+void cli4_fortran_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=5 for an array of arguments, Fortran implementation */
+void cli5_fortran_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
+/** complex polylogarithm with n=6 for an array of arguments, Fortran implementation */
+void cli6_fortran_v(const double* re, const double* im, double* res_re, double* res_im, size_t n);
+
 #endif
 
 #ifdef __cplusplus
@@ -8,10 +8,19 @@
 
 #include "stopwatch.hpp"
 #include <algorithm>
+#include <chrono>
+#include <cmath>
 #include <complex>
+#include <cstdint>
+#include <numeric>
 #include <random>
 #include <vector>
 
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#include <x86intrin.h>
+#define POLYLOGARITHM_BENCH_HAVE_CYCLES 1
+#endif
+
 namespace polylogarithm {
 namespace bench {
 
@@ -44,6 +53,29 @@ std::vector<std::complex<T>> generate_random_complexes(
    return v;
 }
 
+/// generates n random complex numbers in [start, stop]^2, which satisfy pred
+template <class T, class Pred>
+std::vector<std::complex<T>> generate_random_complexes_if(
+   int n, T start, T stop, Pred pred)
+{
+   static std::minstd_rand gen;
+   std::uniform_real_distribution<T> dist(start, stop);
+
+   std::vector<std::complex<T>> v;
+   v.reserve(n);
+
+   while (static_cast<int>(v.size()) < n) {
+      const T re = dist(gen);
+      const T im = dist(gen);
+      const std::complex<T> z(re, im);
+      if (pred(z)) {
+         v.push_back(z);
+      }
+   }
+
+   return v;
+}
+
 template <class T>
 inline void do_not_optimize(const T& value)
 {
@@ -60,5 +92,80 @@ double time_in_seconds(F&& f)
    return sw.get_time_in_seconds();
 }
 
+/// returns the value of the time stamp counter, or 0 if not available
+inline uint64_t read_cycle_counter()
+{
+#ifdef POLYLOGARITHM_BENCH_HAVE_CYCLES
+   return __rdtsc();
+#else
+   return 0;
+#endif
+}
+
+/// returns true if read_cycle_counter() is available
+constexpr bool have_cycle_counter()
+{
+#ifdef POLYLOGARITHM_BENCH_HAVE_CYCLES
+   return true;
+#else
+   return false;
+#endif
+}
+
+/// time in nanoseconds and number of cycles of one call of f
+struct Timing {
+   double nanoseconds{};
+   double cycles{};
+};
+
+template <class F>
+Timing time_call(F&& f)
+{
+   const auto start = std::chrono::steady_clock::now();
+   const uint64_t c0 = read_cycle_counter();
+   f();
+   const uint64_t c1 = read_cycle_counter();
+   const auto stop = std::chrono::steady_clock::now();
+
+   Timing t;
+   t.nanoseconds = std::chrono::duration<double, std::nano>(stop - start).count();
+   t.cycles = static_cast<double>(c1 - c0);
+   return t;
+}
+
+/// summary statistics of a sample
+struct Statistics {
+   double min{};
+   double max{};
+   double median{};
+   double mean{};
+   double stddev{};
+};
+
+inline Statistics calc_statistics(std::vector<double> v)
+{
+   Statistics s;
+
+   if (v.empty()) {
+      return s;
+   }
+
+   std::sort(v.begin(), v.end());
+
+   const std::size_t n = v.size();
+   s.min = v.front();
+   s.max = v.back();
+   s.median = n % 2 == 1 ? v[n/2] : 0.5*(v[n/2 - 1] + v[n/2]);
+   s.mean = std::accumulate(v.begin(), v.end(), 0.0)/n;
+
+   double sum = 0;
+   for (const auto x: v) {
+      sum += (x - s.mean)*(x - s.mean);
+   }
+   s.stddev = n > 1 ? std::sqrt(sum/(n - 1)) : 0.0;
+
+   return s;
+}
+
 } // namespace bench
 } // namespace polylogarithm
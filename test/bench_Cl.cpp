@@ -14,6 +14,7 @@
 #include "Li4.hpp"
 #include "Li5.hpp"
 #include "Li6.hpp"
+#include "Li_dd.hpp"
 #include <iostream>
 #include <iomanip>
 
@@ -164,6 +165,10 @@ void print_headline_2(const std::string& text)
 template<typename T, typename U>
 void bench(const T& values_d, const U& values_l)
 {
+   using DD = polylogarithm::DoubleDouble;
+
+   const std::vector<DD> values_dd(values_d.cbegin(), values_d.cend());
+
    print_headline_2("Cl2");
 
    bench_fn([&](double x) { return polylogarithm::Cl2(x); }, values_d,
@@ -200,6 +205,9 @@ void bench(const T& values_d, const U& values_l)
    bench_fn([&](long double x) { return polylogarithm::Cl2(x); }, values_l,
             "polylogarithm C++", "long double");
 
+   bench_fn([&](const DD& x) { return polylogarithm::Cl2(x); }, values_dd,
+            "polylogarithm C++", "double-double");
+
    bench_fn([&](long double x) { return cl2l(x); }, values_l,
             "polylogarithm C", "long double");
 
@@ -234,6 +242,9 @@ void bench(const T& values_d, const U& values_l)
    bench_fn([&](long double x) { return polylogarithm::Cl3(x); }, values_l,
             "polylogarithm C++", "long double");
 
+   bench_fn([&](const DD& x) { return polylogarithm::Cl3(x); }, values_dd,
+            "polylogarithm C++", "double-double");
+
    bench_fn([&](long double x) { return cl3l(x); }, values_l,
             "polylogarithm C", "long double");
 
@@ -259,6 +270,9 @@ void bench(const T& values_d, const U& values_l)
    bench_fn([&](long double x) { return polylogarithm::Cl4(x); }, values_l,
             "polylogarithm C++", "long double");
 
+   bench_fn([&](const DD& x) { return polylogarithm::Cl4(x); }, values_dd,
+            "polylogarithm C++", "double-double");
+
    bench_fn([&](long double x) { return cl4l(x); }, values_l,
             "polylogarithm C", "long double");
 
@@ -284,6 +298,9 @@ void bench(const T& values_d, const U& values_l)
    bench_fn([&](long double x) { return polylogarithm::Cl5(x); }, values_l,
             "polylogarithm C++", "long double");
 
+   bench_fn([&](const DD& x) { return polylogarithm::Cl5(x); }, values_dd,
+            "polylogarithm C++", "double-double");
+
    bench_fn([&](long double x) { return cl5l(x); }, values_l,
             "polylogarithm C", "long double");
 
@@ -309,6 +326,9 @@ void bench(const T& values_d, const U& values_l)
    bench_fn([&](long double x) { return polylogarithm::Cl6(x); }, values_l,
             "polylogarithm C++", "long double");
 
+   bench_fn([&](const DD& x) { return polylogarithm::Cl6(x); }, values_dd,
+            "polylogarithm C++", "double-double");
+
    bench_fn([&](long double x) { return cl6l(x); }, values_l,
             "polylogarithm C", "long double");
 
@@ -8,6 +8,8 @@
 #include "Li5.hpp"
 #include "Li6.hpp"
 #include "Li.hpp"
+#include "Li_dd.hpp"
+#include "Li_float128.hpp"
 #include <iostream>
 #include <iomanip>
 
@@ -272,6 +274,22 @@ int main() {
    const auto values_cd = generate_random_complexes<double>(N, min, max);
    const auto values_cl = generate_random_complexes<long double>(N, min, max);
 
+   using DD = polylogarithm::DoubleDouble;
+   using CDD = polylogarithm::Complex<DD>;
+
+   const std::vector<DD> values_dd(values_d.cbegin(), values_d.cend());
+   std::vector<CDD> values_cdd;
+   for (const auto& z: values_cd) {
+      values_cdd.emplace_back(z.real(), z.imag());
+   }
+
+#ifdef ENABLE_FLOAT128
+   using CQ = std::complex<__float128>;
+
+   const std::vector<__float128> values_q(values_d.cbegin(), values_d.cend());
+   const std::vector<CQ> values_cq(values_cd.cbegin(), values_cd.cend());
+#endif
+
    print_headline("Li2 (real)");
 
    bench_fn([&](float x) { return polylogarithm::Li2(x); }, values_f,
@@ -323,6 +341,14 @@ int main() {
    bench_fn([&](long double x) { return polylogarithm::Li2(x); }, values_l,
             "polylogarithm C++", "long double");
 
+   bench_fn([&](const DD& x) { return polylogarithm::Li2(x); }, values_dd,
+            "polylogarithm C++", "double-double");
+
+#ifdef ENABLE_FLOAT128
+   bench_fn([&](__float128 x) { return polylogarithm::Li2(x); }, values_q,
+            "polylogarithm C++", "__float128");
+#endif
+
    bench_fn([&](long double x) { return poly_Li2(x); }, values_l,
             "polylogarithm C", "long double");
 
@@ -371,6 +397,14 @@ int main() {
    bench_fn([&](std::complex<long double> z) { return polylogarithm::Li2(z); },
             values_cl, "polylogarithm C++",  "long double");
 
+   bench_fn([&](const CDD& z) { return polylogarithm::Li2(z); },
+            values_cdd, "polylogarithm C++", "double-double");
+
+#ifdef ENABLE_FLOAT128
+   bench_fn([&](const CQ& z) { return polylogarithm::Li2(z); },
+            values_cq, "polylogarithm C++", "__float128");
+#endif
+
    bench_fn([&](std::complex<long double> z) { return poly_Li2(z); },
             values_cl, "polylogarithm C",  "long double");
 
@@ -409,6 +443,14 @@ int main() {
    bench_fn([&](std::complex<long double> z) { return polylogarithm::Li3(z); },
             values_cl, "polylogarithm C++", "long double");
 
+   bench_fn([&](const CDD& z) { return polylogarithm::Li3(z); },
+            values_cdd, "polylogarithm C++", "double-double");
+
+#ifdef ENABLE_FLOAT128
+   bench_fn([&](const CQ& z) { return polylogarithm::Li3(z); },
+            values_cq, "polylogarithm C++", "__float128");
+#endif
+
    bench_fn([&](std::complex<long double> z) { return poly_Li3(z); },
             values_cl, "polylogarithm C", "long double");
 
@@ -444,6 +486,14 @@ int main() {
    bench_fn([&](std::complex<long double> z) { return polylogarithm::Li4(z); },
             values_cd, "polylogarithm C++", "long double");
 
+   bench_fn([&](const CDD& z) { return polylogarithm::Li4(z); },
+            values_cdd, "polylogarithm C++", "double-double");
+
+#ifdef ENABLE_FLOAT128
+   bench_fn([&](const CQ& z) { return polylogarithm::Li4(z); },
+            values_cq, "polylogarithm C++", "__float128");
+#endif
+
    bench_fn([&](std::complex<long double> z) { return poly_Li4(z); },
             values_cd, "polylogarithm C", "long double");
 
@@ -463,6 +513,14 @@ int main() {
    bench_fn([&](std::complex<long double> z) { return polylogarithm::Li5(z); },
             values_cd, "polylogarithm C++", "long double");
 
+   bench_fn([&](const CDD& z) { return polylogarithm::Li5(z); },
+            values_cdd, "polylogarithm C++", "double-double");
+
+#ifdef ENABLE_FLOAT128
+   bench_fn([&](const CQ& z) { return polylogarithm::Li5(z); },
+            values_cq, "polylogarithm C++", "__float128");
+#endif
+
    bench_fn([&](std::complex<long double> z) { return poly_Li5(z); },
             values_cd, "polylogarithm C", "long double");
 
@@ -482,6 +540,14 @@ int main() {
    bench_fn([&](std::complex<long double> z) { return polylogarithm::Li6(z); },
             values_cd, "polylogarithm C++", "long double");
 
+   bench_fn([&](const CDD& z) { return polylogarithm::Li6(z); },
+            values_cdd, "polylogarithm C++", "double-double");
+
+#ifdef ENABLE_FLOAT128
+   bench_fn([&](const CQ& z) { return polylogarithm::Li6(z); },
+            values_cq, "polylogarithm C++", "__float128");
+#endif
+
    bench_fn([&](std::complex<long double> z) { return poly_Li6(z); },
             values_cd, "polylogarithm C", "long double");
 
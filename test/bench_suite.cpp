@@ -0,0 +1,375 @@
+// Structured micro-benchmark of the polylogarithm functions.
+//
+// Each benchmark evaluates one function for one floating-point type on
+// arguments from one region, which corresponds to one transformation
+// branch of the implementation.  After a number of warm-up passes the
+// evaluation is repeated and statistics of the time per call are
+// reported, either as a table or as JSON.
+//
+// Usage: bench_suite [--json] [--filter=<substring>] [--size=<n>]
+//                    [--repetitions=<n>] [--warmup=<n>]
+
+#include "bench.hpp"
+#include "Cl.hpp"
+#include "Cl2Table.hpp"
+#include "Li.hpp"
+#include "Sl.hpp"
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+const double PI = 3.1415926535897932;
+
+struct Options {
+   bool json{false};
+   std::string filter;
+   int size{100000};
+   int repetitions{10};
+   int warmup{2};
+};
+
+struct Result {
+   std::string function;
+   std::string type;
+   std::string region;
+   int size{};
+   int repetitions{};
+   polylogarithm::bench::Statistics ns;     ///< nanoseconds per call
+   polylogarithm::bench::Statistics cycles; ///< time stamp counter cycles per call
+
+   std::string name() const { return function + "/" + type + "/" + region; }
+};
+
+std::vector<Result> results;
+
+template <typename T, typename Fn>
+void bench_fn(const Options& opt, const std::string& function, const std::string& type,
+              const std::string& region, Fn f, const std::vector<T>& values)
+{
+   Result res;
+   res.function = function;
+   res.type = type;
+   res.region = region;
+   res.size = static_cast<int>(values.size());
+   res.repetitions = opt.repetitions;
+
+   if (!opt.filter.empty() && res.name().find(opt.filter) == std::string::npos) {
+      return;
+   }
+
+   const auto run = [&] {
+      for (const auto& v: values) {
+         polylogarithm::bench::do_not_optimize(f(v));
+      }
+   };
+
+   for (int i = 0; i < opt.warmup; ++i) {
+      run();
+   }
+
+   std::vector<double> ns, cycles;
+
+   for (int i = 0; i < opt.repetitions; ++i) {
+      const auto t = polylogarithm::bench::time_call(run);
+      ns.push_back(t.nanoseconds/values.size());
+      cycles.push_back(t.cycles/values.size());
+   }
+
+   res.ns = polylogarithm::bench::calc_statistics(ns);
+   res.cycles = polylogarithm::bench::calc_statistics(cycles);
+
+   results.push_back(res);
+}
+
+template <typename T>
+std::vector<T> reals(const Options& opt, T start, T stop)
+{
+   return polylogarithm::bench::generate_random_scalars<T>(opt.size, start, stop);
+}
+
+template <typename T, typename Pred>
+std::vector<std::complex<T>> complexes(const Options& opt, T start, T stop, Pred pred)
+{
+   return polylogarithm::bench::generate_random_complexes_if<T>(opt.size, start, stop, pred);
+}
+
+/// |log(z)|^2
+template <typename T>
+T norm_log(const std::complex<T>& z)
+{
+   return std::norm(std::log(z));
+}
+
+template <typename T, typename Fn>
+void bench_real_Li(const Options& opt, const std::string& function, const std::string& type, Fn f)
+{
+   bench_fn(opt, function, type, "x<-1"     , f, reals<T>(opt, -10, -1));
+   bench_fn(opt, function, type, "-1<x<0"   , f, reals<T>(opt, -1, 0));
+   bench_fn(opt, function, type, "0<x<0.5"  , f, reals<T>(opt, 0, T(0.5)));
+   bench_fn(opt, function, type, "0.5<x<1"  , f, reals<T>(opt, T(0.5), 1));
+   bench_fn(opt, function, type, "1<x<2"    , f, reals<T>(opt, 1, 2));
+   bench_fn(opt, function, type, "x>2"      , f, reals<T>(opt, 2, 10));
+}
+
+template <typename T, typename Fn>
+void bench_complex_Li2(const Options& opt, const std::string& type, Fn f)
+{
+   using C = std::complex<T>;
+
+   bench_fn(opt, "Li2", type, "Re(z)<=0.5,|z|<=1", f,
+            complexes<T>(opt, -1, 1, [] (C z) { return std::real(z) <= T(0.5) && std::norm(z) <= 1 && std::imag(z) != 0; }));
+   bench_fn(opt, "Li2", type, "Re(z)<=0.5,|z|>1", f,
+            complexes<T>(opt, -5, 5, [] (C z) { return std::real(z) <= T(0.5) && std::norm(z) > 1 && std::imag(z) != 0; }));
+   bench_fn(opt, "Li2", type, "Re(z)>0.5,|z-1|<=1", f,
+            complexes<T>(opt, -5, 5, [] (C z) { return std::real(z) > T(0.5) && std::norm(T(1) - z) <= 1 && std::imag(z) != 0; }));
+   bench_fn(opt, "Li2", type, "Re(z)>0.5,|z-1|>1", f,
+            complexes<T>(opt, -5, 5, [] (C z) { return std::real(z) > T(0.5) && std::norm(T(1) - z) > 1 && std::imag(z) != 0; }));
+}
+
+template <typename T, typename Fn>
+void bench_complex_Li(const Options& opt, const std::string& function, const std::string& type, Fn f)
+{
+   using C = std::complex<T>;
+
+   bench_fn(opt, function, type, "|log(z)|<1", f,
+            complexes<T>(opt, -3, 3, [] (C z) { return std::imag(z) != 0 && norm_log(z) < 1; }));
+   bench_fn(opt, function, type, "|z|<=1,|log(z)|>=1", f,
+            complexes<T>(opt, -1, 1, [] (C z) { return std::imag(z) != 0 && std::norm(z) <= 1 && norm_log(z) >= 1; }));
+   bench_fn(opt, function, type, "|z|>1,|log(z)|>=1", f,
+            complexes<T>(opt, -5, 5, [] (C z) { return std::imag(z) != 0 && std::norm(z) > 1 && norm_log(z) >= 1; }));
+}
+
+void bench_Li(const Options& opt)
+{
+   using namespace polylogarithm;
+   using CF = std::complex<float>;
+   using CD = std::complex<double>;
+   using CL = std::complex<long double>;
+
+   bench_real_Li<float>(opt, "Li2", "float", [] (float x) { return Li2(x); });
+   bench_real_Li<double>(opt, "Li2", "double", [] (double x) { return Li2(x); });
+   bench_real_Li<double>(opt, "Li2_fast", "double", [] (double x) { return Li2_fast(x); });
+   bench_real_Li<long double>(opt, "Li2", "long double", [] (long double x) { return Li2(x); });
+   bench_real_Li<float>(opt, "Li3", "float", [] (float x) { return Li3(x); });
+   bench_real_Li<double>(opt, "Li3", "double", [] (double x) { return Li3(x); });
+   bench_real_Li<double>(opt, "Li3_fast", "double", [] (double x) { return Li3_fast(x); });
+   bench_real_Li<float>(opt, "Li4", "float", [] (float x) { return Li4(x); });
+   bench_real_Li<double>(opt, "Li4", "double", [] (double x) { return Li4(x); });
+
+   bench_complex_Li2<float>(opt, "complex<float>", [] (CF z) { return Li2(z); });
+   bench_complex_Li2<double>(opt, "complex<double>", [] (CD z) { return Li2(z); });
+   bench_complex_Li2<long double>(opt, "complex<long double>", [] (CL z) { return Li2(z); });
+
+   bench_complex_Li<float>(opt, "Li3", "complex<float>", [] (CF z) { return Li3(z); });
+   bench_complex_Li<double>(opt, "Li3", "complex<double>", [] (CD z) { return Li3(z); });
+   bench_complex_Li<long double>(opt, "Li3", "complex<long double>", [] (CL z) { return Li3(z); });
+   bench_complex_Li<float>(opt, "Li4", "complex<float>", [] (CF z) { return Li4(z); });
+   bench_complex_Li<double>(opt, "Li4", "complex<double>", [] (CD z) { return Li4(z); });
+   bench_complex_Li<long double>(opt, "Li4", "complex<long double>", [] (CL z) { return Li4(z); });
+   bench_complex_Li<float>(opt, "Li5", "complex<float>", [] (CF z) { return Li5(z); });
+   bench_complex_Li<double>(opt, "Li5", "complex<double>", [] (CD z) { return Li5(z); });
+   bench_complex_Li<long double>(opt, "Li5", "complex<long double>", [] (CL z) { return Li5(z); });
+   bench_complex_Li<float>(opt, "Li6", "complex<float>", [] (CF z) { return Li6(z); });
+   bench_complex_Li<double>(opt, "Li6", "complex<double>", [] (CD z) { return Li6(z); });
+   bench_complex_Li<long double>(opt, "Li6", "complex<long double>", [] (CL z) { return Li6(z); });
+
+   // Li(n,z): series in z, expansion around z ~ 1 and inversion
+   for (const int64_t n: { -10, 10, 100 }) {
+      const std::string name = "Li(" + std::to_string(n) + ")";
+      bench_fn(opt, name, "complex<double>", "|z|<0.75", [n] (CD z) { return Li(n, z); },
+               complexes<double>(opt, -0.75, 0.75, [] (CD z) { return std::imag(z) != 0 && std::norm(z) < 0.75*0.75; }));
+      bench_fn(opt, name, "complex<double>", "0.75<|z|<1.4", [n] (CD z) { return Li(n, z); },
+               complexes<double>(opt, -1.4, 1.4, [] (CD z) { return std::imag(z) != 0 && std::norm(z) > 0.75*0.75 && std::norm(z) < 1.4*1.4; }));
+      bench_fn(opt, name, "complex<double>", "|z|>1.4", [n] (CD z) { return Li(n, z); },
+               complexes<double>(opt, -10.0, 10.0, [] (CD z) { return std::imag(z) != 0 && std::norm(z) > 1.4*1.4; }));
+   }
+}
+
+template <typename T, typename Fn>
+void bench_Clausen(const Options& opt, const std::string& function, const std::string& type, Fn f)
+{
+   const T pi = static_cast<T>(PI);
+
+   bench_fn(opt, function, type, "0<x<pi/2" , f, reals<T>(opt, 0, pi/2));
+   bench_fn(opt, function, type, "pi/2<x<pi", f, reals<T>(opt, pi/2, pi));
+   bench_fn(opt, function, type, "pi<x<2pi" , f, reals<T>(opt, pi, 2*pi));
+   bench_fn(opt, function, type, "|x|<100"  , f, reals<T>(opt, -100, 100));
+}
+
+void bench_Cl(const Options& opt)
+{
+   using namespace polylogarithm;
+
+   bench_Clausen<double>(opt, "Cl1", "double", [] (double x) { return Cl1(x); });
+   bench_Clausen<float>(opt, "Cl2", "float", [] (float x) { return Cl2(x); });
+   bench_Clausen<double>(opt, "Cl2", "double", [] (double x) { return Cl2(x); });
+   bench_Clausen<double>(opt, "Cl2_fast", "double", [] (double x) { return Cl2_fast(x); });
+   {
+      const Cl2Table table;
+      bench_Clausen<double>(opt, "Cl2_table", "double", [&table] (double x) { return table(x); });
+   }
+   bench_Clausen<long double>(opt, "Cl2", "long double", [] (long double x) { return Cl2(x); });
+   bench_Clausen<float>(opt, "Cl3", "float", [] (float x) { return Cl3(x); });
+   bench_Clausen<double>(opt, "Cl3", "double", [] (double x) { return Cl3(x); });
+   bench_Clausen<long double>(opt, "Cl3", "long double", [] (long double x) { return Cl3(x); });
+   bench_Clausen<float>(opt, "Cl4", "float", [] (float x) { return Cl4(x); });
+   bench_Clausen<double>(opt, "Cl4", "double", [] (double x) { return Cl4(x); });
+   bench_Clausen<long double>(opt, "Cl4", "long double", [] (long double x) { return Cl4(x); });
+   bench_Clausen<float>(opt, "Cl5", "float", [] (float x) { return Cl5(x); });
+   bench_Clausen<double>(opt, "Cl5", "double", [] (double x) { return Cl5(x); });
+   bench_Clausen<long double>(opt, "Cl5", "long double", [] (long double x) { return Cl5(x); });
+   bench_Clausen<float>(opt, "Cl6", "float", [] (float x) { return Cl6(x); });
+   bench_Clausen<double>(opt, "Cl6", "double", [] (double x) { return Cl6(x); });
+   bench_Clausen<long double>(opt, "Cl6", "long double", [] (long double x) { return Cl6(x); });
+
+   // Cl(n,x): closed forms (n <= 6), Wu et al. (n <= 9) and series (n > 9)
+   for (const int64_t n: { 6, 9, 10, 100 }) {
+      bench_Clausen<double>(opt, "Cl(" + std::to_string(n) + ")", "double", [n] (double x) { return Cl(n, x); });
+   }
+
+   for (const int64_t n: { 1, 2, 10, 100 }) {
+      bench_Clausen<double>(opt, "Sl(" + std::to_string(n) + ")", "double", [n] (double x) { return Sl(n, x); });
+   }
+}
+
+std::string escape_json(const std::string& s)
+{
+   std::string res;
+
+   for (const char c: s) {
+      if (c == '"' || c == '\\') {
+         res += '\\';
+      }
+      res += c;
+   }
+
+   return res;
+}
+
+void print_statistics_json(std::ostream& ostr, const std::string& name,
+                           const polylogarithm::bench::Statistics& s)
+{
+   ostr << "\"" << name << "\": {"
+        << "\"min\": " << s.min << ", "
+        << "\"max\": " << s.max << ", "
+        << "\"median\": " << s.median << ", "
+        << "\"mean\": " << s.mean << ", "
+        << "\"stddev\": " << s.stddev << "}";
+}
+
+void print_json(const Options& opt)
+{
+   std::cout << std::setprecision(6)
+             << "{\n"
+             << "  \"context\": {\n"
+             << "    \"size\": " << opt.size << ",\n"
+             << "    \"repetitions\": " << opt.repetitions << ",\n"
+             << "    \"warmup\": " << opt.warmup << ",\n"
+             << "    \"cycle_counter\": " << (polylogarithm::bench::have_cycle_counter() ? "true" : "false") << "\n"
+             << "  },\n"
+             << "  \"benchmarks\": [";
+
+   for (std::size_t i = 0; i < results.size(); ++i) {
+      const auto& r = results[i];
+      std::cout << (i == 0 ? "\n" : ",\n")
+                << "    {"
+                << "\"name\": \"" << escape_json(r.name()) << "\", "
+                << "\"function\": \"" << escape_json(r.function) << "\", "
+                << "\"type\": \"" << escape_json(r.type) << "\", "
+                << "\"region\": \"" << escape_json(r.region) << "\", "
+                << "\"size\": " << r.size << ", "
+                << "\"repetitions\": " << r.repetitions << ", ";
+      print_statistics_json(std::cout, "ns_per_call", r.ns);
+      std::cout << ", ";
+      if (polylogarithm::bench::have_cycle_counter()) {
+         print_statistics_json(std::cout, "cycles_per_call", r.cycles);
+      } else {
+         std::cout << "\"cycles_per_call\": null";
+      }
+      std::cout << ", \"calls_per_second\": " << (r.ns.median > 0 ? 1e9/r.ns.median : 0.0)
+                << "}";
+   }
+
+   std::cout << "\n  ]\n}\n";
+}
+
+void print_table()
+{
+   std::cout << std::left << std::setw(56) << "benchmark"
+             << std::right << std::setw(12) << "ns/call"
+             << std::setw(10) << "+/-"
+             << std::setw(12) << "cycles/call"
+             << std::setw(14) << "Mcalls/s" << '\n'
+             << std::string(104, '-') << '\n'
+             << std::fixed << std::setprecision(2);
+
+   for (const auto& r: results) {
+      std::cout << std::left << std::setw(56) << r.name()
+                << std::right << std::setw(12) << r.ns.median
+                << std::setw(10) << r.ns.stddev
+                << std::setw(12) << r.cycles.median
+                << std::setw(14) << (r.ns.median > 0 ? 1e3/r.ns.median : 0.0) << '\n';
+   }
+}
+
+bool starts_with(const std::string& s, const std::string& prefix)
+{
+   return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+int to_positive_int(const std::string& s)
+{
+   const int i = std::atoi(s.c_str());
+   return i > 0 ? i : 1;
+}
+
+void print_usage()
+{
+   std::cout << "Usage: bench_suite [--json] [--filter=<substring>] [--size=<n>]\n"
+                "                   [--repetitions=<n>] [--warmup=<n>]\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+   Options opt;
+
+   for (int i = 1; i < argc; ++i) {
+      const std::string arg(argv[i]);
+      if (arg == "--json") {
+         opt.json = true;
+      } else if (starts_with(arg, "--filter=")) {
+         opt.filter = arg.substr(9);
+      } else if (starts_with(arg, "--size=")) {
+         opt.size = to_positive_int(arg.substr(7));
+      } else if (starts_with(arg, "--repetitions=")) {
+         opt.repetitions = to_positive_int(arg.substr(14));
+      } else if (starts_with(arg, "--warmup=")) {
+         opt.warmup = std::atoi(arg.substr(9).c_str());
+      } else if (arg == "--help" || arg == "-h") {
+         print_usage();
+         return EXIT_SUCCESS;
+      } else {
+         std::cerr << "Error: unknown argument: " << arg << '\n';
+         print_usage();
+         return EXIT_FAILURE;
+      }
+   }
+
+   bench_Li(opt);
+   bench_Cl(opt);
+
+   if (opt.json) {
+      print_json(opt);
+   } else {
+      print_table();
+   }
+
+   return EXIT_SUCCESS;
+}
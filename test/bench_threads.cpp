@@ -0,0 +1,339 @@
+// Multi-threaded scaling benchmark of the polylogarithm functions.
+//
+// For each function and each number of threads t = 1,...,N all t
+// threads evaluate the function on the same shared, read-only input
+// buffer and write to their own output buffer.  The threads are
+// released simultaneously and each thread measures its own time.
+// Reported are the throughput of all threads, the scaling efficiency
+// relative to t times the single-threaded throughput, and the spread
+// of the per-thread times.  A drop of the efficiency points to shared
+// state, false sharing, frequency scaling or memory-bandwidth limits.
+//
+// The output of every thread is compared bit-wise to a
+// single-threaded reference evaluation.  The program exits with an
+// error if any thread computed a different value, which would indicate
+// hidden shared state in the implementation.
+//
+// Usage: bench_threads [--json] [--filter=<substring>] [--threads=<n>]
+//                      [--size=<n>] [--repetitions=<n>]
+
+#include "bench.hpp"
+#include "Cl.hpp"
+#include "Li.hpp"
+#include "Sl.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+struct Options {
+   bool json{false};
+   std::string filter;
+   int threads{static_cast<int>(std::thread::hardware_concurrency())};
+   int size{20000};
+   int repetitions{5};
+};
+
+struct Result {
+   std::string function;
+   std::string type;
+   int threads{};
+   double calls_per_second{}; ///< throughput of all threads
+   double efficiency{};       ///< throughput relative to threads*(single-threaded throughput)
+   polylogarithm::bench::Statistics ms; ///< time per thread in milliseconds
+   std::size_t mismatches{};  ///< number of values that differ from the reference
+
+   std::string name() const { return function + "/" + type; }
+};
+
+std::vector<Result> results;
+
+/// returns true if the two values are bit-wise identical
+template <typename T>
+bool identical(const T& a, const T& b)
+{
+   return std::memcmp(&a, &b, sizeof(T)) == 0;
+}
+
+template <typename T, typename Fn>
+void bench_fn(const Options& opt, const std::string& function, const std::string& type,
+              Fn f, const std::vector<T>& values)
+{
+   using U = decltype(f(values[0]));
+
+   if (!opt.filter.empty() && (function + "/" + type).find(opt.filter) == std::string::npos) {
+      return;
+   }
+
+   std::vector<U> reference(values.size());
+   for (std::size_t i = 0; i < values.size(); ++i) {
+      reference[i] = f(values[i]);
+   }
+
+   double calls_per_second_1 = 0;
+
+   for (int n_threads = 1; n_threads <= opt.threads; ++n_threads) {
+      Result res;
+      res.function = function;
+      res.type = type;
+      res.threads = n_threads;
+
+      // one output buffer per thread, allocated separately to avoid
+      // false sharing between the threads
+      std::vector<std::vector<U>> out(n_threads, std::vector<U>(values.size()));
+      std::vector<double> seconds(n_threads);
+      std::vector<double> thread_ms, wall;
+
+      for (int rep = 0; rep < opt.repetitions; ++rep) {
+         std::atomic<int> ready(0);
+         std::atomic<bool> go(false);
+         std::vector<std::thread> threads;
+
+         for (int t = 0; t < n_threads; ++t) {
+            threads.emplace_back([&, t] {
+               auto& o = out[t];
+               ready++;
+               while (!go) {
+                  std::this_thread::yield();
+               }
+               const auto start = std::chrono::steady_clock::now();
+               for (std::size_t i = 0; i < values.size(); ++i) {
+                  o[i] = f(values[i]);
+               }
+               const auto stop = std::chrono::steady_clock::now();
+               seconds[t] = std::chrono::duration<double>(stop - start).count();
+            });
+         }
+
+         while (ready < n_threads) {
+            std::this_thread::yield();
+         }
+         go = true;
+
+         for (auto& t: threads) {
+            t.join();
+         }
+
+         double max_seconds = 0;
+         for (const auto s: seconds) {
+            thread_ms.push_back(1e3*s);
+            max_seconds = s > max_seconds ? s : max_seconds;
+         }
+         wall.push_back(max_seconds);
+      }
+
+      for (const auto& o: out) {
+         for (std::size_t i = 0; i < o.size(); ++i) {
+            if (!identical(o[i], reference[i])) {
+               res.mismatches++;
+            }
+         }
+      }
+
+      const double wall_median = polylogarithm::bench::calc_statistics(wall).median;
+
+      res.ms = polylogarithm::bench::calc_statistics(thread_ms);
+      res.calls_per_second = wall_median > 0 ? n_threads*values.size()/wall_median : 0.0;
+
+      if (n_threads == 1) {
+         calls_per_second_1 = res.calls_per_second;
+      }
+
+      res.efficiency = calls_per_second_1 > 0
+         ? res.calls_per_second/(n_threads*calls_per_second_1) : 0.0;
+
+      results.push_back(res);
+   }
+}
+
+void bench_Li(const Options& opt)
+{
+   using namespace polylogarithm;
+   using polylogarithm::bench::generate_random_scalars;
+   using polylogarithm::bench::generate_random_complexes;
+
+   const auto x = generate_random_scalars<double>(opt.size, -10, 10);
+   const auto z = generate_random_complexes<double>(opt.size, -5, 5);
+
+   using CD = std::complex<double>;
+
+   bench_fn(opt, "Li2", "double", [] (double x) { return Li2(x); }, x);
+   bench_fn(opt, "Li3", "double", [] (double x) { return Li3(x); }, x);
+   bench_fn(opt, "Li4", "double", [] (double x) { return Li4(x); }, x);
+   bench_fn(opt, "Li2", "complex<double>", [] (const CD& z) { return Li2(z); }, z);
+   bench_fn(opt, "Li3", "complex<double>", [] (const CD& z) { return Li3(z); }, z);
+   bench_fn(opt, "Li4", "complex<double>", [] (const CD& z) { return Li4(z); }, z);
+   bench_fn(opt, "Li5", "complex<double>", [] (const CD& z) { return Li5(z); }, z);
+   bench_fn(opt, "Li6", "complex<double>", [] (const CD& z) { return Li6(z); }, z);
+
+   for (const int64_t n: { -10, 10, 100 }) {
+      bench_fn(opt, "Li(" + std::to_string(n) + ")", "complex<double>",
+               [n] (const CD& z) { return Li(n, z); }, z);
+   }
+}
+
+void bench_Cl(const Options& opt)
+{
+   using namespace polylogarithm;
+
+   const auto x = polylogarithm::bench::generate_random_scalars<double>(opt.size, -10, 10);
+
+   // closed forms (n <= 6), Wu et al. (n <= 9) and series (n > 9)
+   for (const int64_t n: { 2, 6, 9, 10, 100 }) {
+      bench_fn(opt, "Cl(" + std::to_string(n) + ")", "double",
+               [n] (double x) { return Cl(n, x); }, x);
+   }
+
+   // polynomials (n <= 25) and series (n > 25)
+   for (const int64_t n: { 1, 10, 30, 100 }) {
+      bench_fn(opt, "Sl(" + std::to_string(n) + ")", "double",
+               [n] (double x) { return Sl(n, x); }, x);
+   }
+}
+
+std::string escape_json(const std::string& s)
+{
+   std::string res;
+
+   for (const char c: s) {
+      if (c == '"' || c == '\\') {
+         res += '\\';
+      }
+      res += c;
+   }
+
+   return res;
+}
+
+void print_json(const Options& opt)
+{
+   std::cout << std::setprecision(6)
+             << "{\n"
+             << "  \"context\": {\n"
+             << "    \"threads\": " << opt.threads << ",\n"
+             << "    \"size\": " << opt.size << ",\n"
+             << "    \"repetitions\": " << opt.repetitions << "\n"
+             << "  },\n"
+             << "  \"benchmarks\": [";
+
+   for (std::size_t i = 0; i < results.size(); ++i) {
+      const auto& r = results[i];
+      std::cout << (i == 0 ? "\n" : ",\n")
+                << "    {"
+                << "\"name\": \"" << escape_json(r.name()) << "\", "
+                << "\"function\": \"" << escape_json(r.function) << "\", "
+                << "\"type\": \"" << escape_json(r.type) << "\", "
+                << "\"threads\": " << r.threads << ", "
+                << "\"calls_per_second\": " << r.calls_per_second << ", "
+                << "\"efficiency\": " << r.efficiency << ", "
+                << "\"ms_per_thread\": {"
+                << "\"min\": " << r.ms.min << ", "
+                << "\"max\": " << r.ms.max << ", "
+                << "\"median\": " << r.ms.median << ", "
+                << "\"mean\": " << r.ms.mean << ", "
+                << "\"stddev\": " << r.ms.stddev << "}, "
+                << "\"mismatches\": " << r.mismatches
+                << "}";
+   }
+
+   std::cout << "\n  ]\n}\n";
+}
+
+void print_table()
+{
+   std::cout << std::left << std::setw(32) << "benchmark"
+             << std::right << std::setw(8) << "threads"
+             << std::setw(12) << "Mcalls/s"
+             << std::setw(12) << "efficiency"
+             << std::setw(14) << "ms/thread"
+             << std::setw(10) << "+/-"
+             << std::setw(12) << "mismatches" << '\n'
+             << std::string(100, '-') << '\n'
+             << std::fixed << std::setprecision(2);
+
+   for (const auto& r: results) {
+      std::cout << std::left << std::setw(32) << r.name()
+                << std::right << std::setw(8) << r.threads
+                << std::setw(12) << 1e-6*r.calls_per_second
+                << std::setw(12) << r.efficiency
+                << std::setw(14) << r.ms.mean
+                << std::setw(10) << r.ms.stddev
+                << std::setw(12) << r.mismatches << '\n';
+   }
+}
+
+bool starts_with(const std::string& s, const std::string& prefix)
+{
+   return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+int to_positive_int(const std::string& s)
+{
+   const int i = std::atoi(s.c_str());
+   return i > 0 ? i : 1;
+}
+
+void print_usage()
+{
+   std::cout << "Usage: bench_threads [--json] [--filter=<substring>] [--threads=<n>]\n"
+                "                     [--size=<n>] [--repetitions=<n>]\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+   Options opt;
+
+   if (opt.threads < 1) {
+      opt.threads = 1;
+   }
+
+   for (int i = 1; i < argc; ++i) {
+      const std::string arg(argv[i]);
+      if (arg == "--json") {
+         opt.json = true;
+      } else if (starts_with(arg, "--filter=")) {
+         opt.filter = arg.substr(9);
+      } else if (starts_with(arg, "--threads=")) {
+         opt.threads = to_positive_int(arg.substr(10));
+      } else if (starts_with(arg, "--size=")) {
+         opt.size = to_positive_int(arg.substr(7));
+      } else if (starts_with(arg, "--repetitions=")) {
+         opt.repetitions = to_positive_int(arg.substr(14));
+      } else if (arg == "--help" || arg == "-h") {
+         print_usage();
+         return EXIT_SUCCESS;
+      } else {
+         std::cerr << "Error: unknown argument: " << arg << '\n';
+         print_usage();
+         return EXIT_FAILURE;
+      }
+   }
+
+   bench_Li(opt);
+   bench_Cl(opt);
+
+   if (opt.json) {
+      print_json(opt);
+   } else {
+      print_table();
+   }
+
+   for (const auto& r: results) {
+      if (r.mismatches != 0) {
+         std::cerr << "Error: " << r.name() << " with " << r.threads
+                   << " threads differs from the single-threaded result\n";
+         return EXIT_FAILURE;
+      }
+   }
+
+   return EXIT_SUCCESS;
+}
@@ -0,0 +1,96 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include "doctest.h"
+#include <cstddef>
+#include <vector>
+
+namespace polylogarithm {
+namespace test {
+
+/// calls a scalar function of the C interface, y = f(x)
+template <typename T>
+T call_scalar(T (*f)(T), T x)
+{
+   return f(x);
+}
+
+/// calls a scalar function of the Fortran interface, f(&x, &y)
+template <typename T>
+T call_scalar(void (*f)(const T*, T*), T x)
+{
+   T res{};
+   f(&x, &res);
+   return res;
+}
+
+/// calls a complex scalar function of the C interface
+template <typename T>
+void call_scalar(void (*f)(T, T, T*, T*), T re, T im, T* res_re, T* res_im)
+{
+   f(re, im, res_re, res_im);
+}
+
+/// calls a complex scalar function of the Fortran interface
+template <typename T>
+void call_scalar(void (*f)(const T*, const T*, T*, T*), T re, T im, T* res_re, T* res_im)
+{
+   f(&re, &im, res_re, res_im);
+}
+
+/**
+ * Checks that the batch function batch(x, res, n) of the C or Fortran
+ * interface yields the same result as the scalar function for each of
+ * n real arguments in [-10,10).
+ */
+template <typename T, typename Scalar>
+void check_real_batch(void (*batch)(const T*, T*, std::size_t), Scalar scalar)
+{
+   const std::size_t n = 200;
+   std::vector<T> x, res(n);
+
+   for (std::size_t i = 0; i < n; ++i) {
+      x.push_back(static_cast<T>(-10 + 0.1*i));
+   }
+
+   batch(x.data(), res.data(), n);
+
+   for (std::size_t i = 0; i < n; ++i) {
+      INFO("x = " << x[i]);
+      CHECK(res[i] == call_scalar(scalar, x[i]));
+   }
+}
+
+/**
+ * Checks that the batch function batch(re, im, res_re, res_im, n) of
+ * the C or Fortran interface yields the same result as the scalar
+ * function for each of n complex arguments, every third one real.
+ */
+template <typename T, typename Scalar>
+void check_complex_batch(void (*batch)(const T*, const T*, T*, T*, std::size_t), Scalar scalar)
+{
+   const std::size_t n = 200;
+   std::vector<T> re, im, res_re(n), res_im(n);
+
+   for (std::size_t i = 0; i < n; ++i) {
+      re.push_back(static_cast<T>(-5 + 0.05*i));
+      im.push_back(static_cast<T>(i % 3 == 0 ? 0.0 : 3 - 0.03*i));
+   }
+
+   batch(re.data(), im.data(), res_re.data(), res_im.data(), n);
+
+   for (std::size_t i = 0; i < n; ++i) {
+      T expected_re{}, expected_im{};
+      call_scalar(scalar, re[i], im[i], &expected_re, &expected_im);
+      INFO("z = (" << re[i] << ", " << im[i] << ")");
+      CHECK(res_re[i] == expected_re);
+      CHECK(res_im[i] == expected_im);
+   }
+}
+
+} // namespace test
+} // namespace polylogarithm
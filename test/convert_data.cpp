@@ -0,0 +1,64 @@
+// Converts a reference data file from test/data/ to the binary format
+// defined in mapped_data.hpp.  Files with two columns are converted to
+// real records, files with four columns to complex records.
+//
+// Usage: convert_data <input.txt> <output.bin>
+
+#include "mapped_data.hpp"
+#include "read_data.hpp"
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+namespace {
+
+/// returns the number of columns in the first line of the file
+int count_columns(const std::string& filename)
+{
+   std::ifstream fstr(filename);
+   std::string line, word;
+   std::getline(fstr, line);
+
+   std::istringstream isstr(line);
+   int n = 0;
+
+   while (isstr >> word) {
+      n++;
+   }
+
+   return n;
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+   using namespace polylogarithm::test;
+
+   if (argc != 3) {
+      std::cerr << "Usage: convert_data <input.txt> <output.bin>\n";
+      return EXIT_FAILURE;
+   }
+
+   const std::string input(argv[1]), output(argv[2]);
+
+   try {
+      const int columns = count_columns(input);
+
+      if (columns == 2) {
+         write_reals_to_binary_file(output, read_reals_from_file<long double>(input));
+      } else if (columns == 4) {
+         write_complexes_to_binary_file(output, read_from_file<long double>(input));
+      } else {
+         std::cerr << "Error: " << input << ": unexpected number of columns: " << columns << '\n';
+         return EXIT_FAILURE;
+      }
+   } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return EXIT_FAILURE;
+   }
+
+   return EXIT_SUCCESS;
+}
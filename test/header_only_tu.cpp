@@ -0,0 +1,46 @@
+// Second translation unit of test_header_only, which includes the
+// same headers as test_header_only.cpp.  Linking both translation
+// units checks that the inline definitions of the header-only mode do
+// not lead to multiply defined symbols.
+
+#include "Cl.hpp"
+#include "Cl2Table.hpp"
+#include "Cl_all.hpp"
+#include "Li.hpp"
+#include "LiPlan.hpp"
+#include "Li_all.hpp"
+#include "Li_dd.hpp"
+#include "Li_float128.hpp"
+#include "Sl.hpp"
+#include "branch_counter.hpp"
+#include "inv_pow.hpp"
+#include "parallel.hpp"
+#include <complex>
+#include <vector>
+
+namespace polylogarithm {
+namespace test {
+
+std::vector<double> header_only_values(double x)
+{
+   const std::complex<double> z(x, 0.5);
+   const Cl2Table table(64);
+   const LiPlan plan(8);
+
+   return {
+      Li2(x), Li3(x), Li4(x), Li2_fast(x), Li3_fast(x),
+      std::real(Li2(z)), std::imag(Li3(z)), std::real(Li4(z)),
+      std::imag(Li5(z)), std::real(Li6(z)), std::imag(Li(7, z)),
+      std::real(Li_all(z)[4]), std::imag(plan(z)),
+      Cl1(x), Cl2(x), Cl3(x), Cl4(x), Cl5(x), Cl6(x), Cl2_fast(x),
+      Cl(12, x), Sl(12, x), Cl_all(x)[5], table(x)
+   };
+}
+
+const std::vector<double>* header_only_inv_pow(int64_t n)
+{
+   return inv_pow(n).get();
+}
+
+} // namespace test
+} // namespace polylogarithm
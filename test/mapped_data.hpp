@@ -0,0 +1,263 @@
+// ====================================================================
+// This file is part of Polylogarithm.
+//
+// Polylogarithm is licenced under the MIT License.
+// ====================================================================
+
+#pragma once
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace polylogarithm {
+namespace test {
+
+/**
+ * Header of a binary reference data file.
+ *
+ * The header is followed by count records of type RealRecord or
+ * ComplexRecord.  The data are stored in the byte order of the machine
+ * which wrote the file, which is checked by the reader.
+ */
+struct DataHeader {
+   char magic[8];     ///< "PLGREF1"
+   uint32_t order;    ///< byte order mark 0x01020304
+   uint32_t complex;  ///< 0 = RealRecord, 1 = ComplexRecord
+   uint64_t count;    ///< number of records
+};
+
+/// real argument x and reference value hi + lo
+struct RealRecord {
+   double x;
+   double hi;
+   double lo;
+};
+
+/// complex argument (re, im) and reference value (re_hi + re_lo, im_hi + im_lo)
+struct ComplexRecord {
+   double re;
+   double im;
+   double re_hi;
+   double re_lo;
+   double im_hi;
+   double im_lo;
+};
+
+namespace detail {
+
+constexpr char DATA_MAGIC[8] = "PLGREF1";
+constexpr uint32_t DATA_ORDER = 0x01020304;
+
+static_assert(sizeof(DataHeader) == 24, "DataHeader must not contain padding");
+static_assert(sizeof(RealRecord) == 3*sizeof(double), "RealRecord must not contain padding");
+static_assert(sizeof(ComplexRecord) == 6*sizeof(double), "ComplexRecord must not contain padding");
+
+/// splits a long double into an unevaluated sum hi + lo of two doubles
+inline void split(long double x, double& hi, double& lo)
+{
+   hi = static_cast<double>(x);
+   lo = static_cast<double>(x - hi);
+}
+
+inline void write_data(const std::string& filename, uint32_t complex,
+                       uint64_t count, const void* records, std::size_t size)
+{
+   DataHeader header;
+   std::memcpy(header.magic, DATA_MAGIC, sizeof(header.magic));
+   header.order = DATA_ORDER;
+   header.complex = complex;
+   header.count = count;
+
+   std::ofstream fstr(filename, std::ios::binary);
+   fstr.write(reinterpret_cast<const char*>(&header), sizeof(header));
+   fstr.write(static_cast<const char*>(records), size);
+
+   if (!fstr) {
+      throw std::runtime_error("cannot write " + filename);
+   }
+}
+
+} // namespace detail
+
+/**
+ * Writes real arguments and reference values to a binary file.
+ *
+ * @param filename file name
+ * @param data vector of pairs of arguments and reference values
+ */
+inline void write_reals_to_binary_file(
+   const std::string& filename,
+   const std::vector<std::pair<long double, long double>>& data)
+{
+   std::vector<RealRecord> records(data.size());
+
+   for (std::size_t i = 0; i < data.size(); ++i) {
+      records[i].x = static_cast<double>(data[i].first);
+      detail::split(data[i].second, records[i].hi, records[i].lo);
+   }
+
+   detail::write_data(filename, 0, records.size(), records.data(),
+                      records.size()*sizeof(RealRecord));
+}
+
+/**
+ * Writes complex arguments and reference values to a binary file.
+ *
+ * @param filename file name
+ * @param data vector of pairs of arguments and reference values
+ */
+inline void write_complexes_to_binary_file(
+   const std::string& filename,
+   const std::vector<std::pair<std::complex<long double>, std::complex<long double>>>& data)
+{
+   std::vector<ComplexRecord> records(data.size());
+
+   for (std::size_t i = 0; i < data.size(); ++i) {
+      records[i].re = static_cast<double>(std::real(data[i].first));
+      records[i].im = static_cast<double>(std::imag(data[i].first));
+      detail::split(std::real(data[i].second), records[i].re_hi, records[i].re_lo);
+      detail::split(std::imag(data[i].second), records[i].im_hi, records[i].im_lo);
+   }
+
+   detail::write_data(filename, 1, records.size(), records.data(),
+                      records.size()*sizeof(ComplexRecord));
+}
+
+/**
+ * Read-only view of a binary reference data file.
+ *
+ * The file is mapped into memory, so that the records can be accessed
+ * without parsing or copying.  On platforms without mmap the file is
+ * read into a buffer instead.
+ */
+class MappedData {
+public:
+   explicit MappedData(const std::string& filename)
+   {
+#ifndef _WIN32
+      const int fd = ::open(filename.c_str(), O_RDONLY);
+      if (fd < 0) {
+         throw std::runtime_error("cannot open " + filename);
+      }
+
+      struct stat st;
+      if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(DataHeader))) {
+         ::close(fd);
+         throw std::runtime_error(filename + " is not a reference data file");
+      }
+
+      length = static_cast<std::size_t>(st.st_size);
+      void* ptr = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+      ::close(fd);
+
+      if (ptr == MAP_FAILED) {
+         throw std::runtime_error("cannot map " + filename);
+      }
+
+      mapped = ptr;
+      data = static_cast<const char*>(ptr);
+#else
+      std::ifstream fstr(filename, std::ios::binary | std::ios::ate);
+      if (!fstr) {
+         throw std::runtime_error("cannot open " + filename);
+      }
+      buffer.resize(static_cast<std::size_t>(fstr.tellg()));
+      fstr.seekg(0);
+      fstr.read(buffer.data(), buffer.size());
+      length = buffer.size();
+      data = buffer.data();
+#endif
+
+      const std::string error = check(filename);
+
+      if (!error.empty()) {
+         unmap();
+         throw std::runtime_error(error);
+      }
+   }
+
+   ~MappedData() { unmap(); }
+
+   MappedData(const MappedData&) = delete;
+   MappedData& operator=(const MappedData&) = delete;
+
+   /// returns true if the file contains complex records
+   bool is_complex() const noexcept { return header().complex != 0; }
+
+   /// returns the number of records
+   std::size_t size() const noexcept { return static_cast<std::size_t>(header().count); }
+
+   /// returns the real records
+   const RealRecord* reals() const
+   {
+      if (is_complex()) {
+         throw std::logic_error("reference data file contains complex records");
+      }
+      return reinterpret_cast<const RealRecord*>(data + sizeof(DataHeader));
+   }
+
+   /// returns the complex records
+   const ComplexRecord* complexes() const
+   {
+      if (!is_complex()) {
+         throw std::logic_error("reference data file contains real records");
+      }
+      return reinterpret_cast<const ComplexRecord*>(data + sizeof(DataHeader));
+   }
+
+private:
+   const char* data{nullptr}; ///< begin of the file contents
+   std::size_t length{0};     ///< size of the file in bytes
+   void* mapped{nullptr};     ///< address of the mapping
+   std::vector<char> buffer;  ///< file contents if mmap is not available
+
+   const DataHeader& header() const noexcept
+   {
+      return *reinterpret_cast<const DataHeader*>(data);
+   }
+
+   void unmap() noexcept
+   {
+#ifndef _WIN32
+      if (mapped) {
+         ::munmap(mapped, length);
+         mapped = nullptr;
+      }
+#endif
+   }
+
+   /// returns an error message if the file is invalid, otherwise an empty string
+   std::string check(const std::string& filename) const
+   {
+      if (length < sizeof(DataHeader) ||
+          std::memcmp(header().magic, detail::DATA_MAGIC, sizeof(detail::DATA_MAGIC)) != 0) {
+         return filename + " is not a reference data file";
+      }
+      if (header().order != detail::DATA_ORDER) {
+         return filename + " has a different byte order";
+      }
+
+      const std::size_t record_size = is_complex() ? sizeof(ComplexRecord) : sizeof(RealRecord);
+
+      if (length != sizeof(DataHeader) + size()*record_size) {
+         return filename + " has an invalid size";
+      }
+
+      return {};
+   }
+};
+
+} // namespace test
+} // namespace polylogarithm
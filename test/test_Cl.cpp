@@ -112,6 +112,31 @@ TEST_CASE("test_fixed_implementations")
    }
 }
 
+TEST_CASE("test_compile_time_order")
+{
+   using polylogarithm::Cl;
+
+   const double pi = M_PI;
+   const auto thetas = float_range(-2*pi, 2*pi, 100);
+
+   for (const auto t: thetas) {
+      INFO("x = " << t);
+      if (t != 0) {
+         CHECK(Cl<1>(t) == Cl(1,t));
+      }
+      CHECK(Cl<2>(t) == Cl(2,t));
+      CHECK(Cl<3>(t) == Cl(3,t));
+      CHECK(Cl<4>(t) == Cl(4,t));
+      CHECK(Cl<5>(t) == Cl(5,t));
+      CHECK(Cl<6>(t) == Cl(6,t));
+      CHECK(Cl<7>(t) == Cl(7,t));
+      CHECK(Cl<8>(t) == Cl(8,t));
+      CHECK(Cl<9>(t) == Cl(9,t));
+      CHECK(Cl<10>(t) == Cl(10,t));
+      CHECK(Cl<16>(t) == Cl(16,t));
+   }
+}
+
 TEST_CASE("test_fixed_values")
 {
    const int ni[] = {
@@ -161,3 +186,33 @@ TEST_CASE("test_roots")
       CHECK_SMALL(Cl(2,k*pi), 1e-14);
    }
 }
+
+TEST_CASE("test_grid")
+{
+   struct Grid { double x0; double h; std::size_t count; };
+
+   const Grid grids[] = {
+      {  0.0     , 0.001 , 10000 },
+      { -20.0    , 0.004 , 10000 },
+      {  M_PI    , -0.03 , 1000  },
+      {  1.0     , 2*M_PI, 10    },
+      {  0.5     , 0.0   , 100   }
+   };
+
+   for (int64_t n = 1; n <= 40; ++n) {
+      for (const auto& g: grids) {
+         const auto values = polylogarithm::Cl_grid(n, g.x0, g.h, g.count);
+
+         REQUIRE(values.size() == g.count);
+
+         for (std::size_t k = 0; k < g.count; ++k) {
+            const double x = g.x0 + k*g.h;
+            INFO("n = " << n << ", x = " << x);
+            CHECK_CLOSE(values[k], polylogarithm::Cl(n, x), 1e-13);
+         }
+      }
+   }
+
+   polylogarithm::Cl_grid(3, 0.0, 0.1, 0, nullptr);
+   CHECK(std::isnan(polylogarithm::Cl_grid(0, 1.0, 0.1, 1)[0]));
+}
@@ -6,6 +6,7 @@
 #include "fortran_wrappers.h"
 #include "Cl2.hpp"
 #include "Li2.hpp"
+#include "check_batch.hpp"
 #include "read_data.hpp"
 #include <cmath>
 #include <complex>
@@ -230,3 +231,64 @@ TEST_CASE("test_real_fixed_values")
       CHECK_CLOSE(cl128_li2      , cl128_expected, 10*eps128);
    }
 }
+
+TEST_CASE("test_single_precision")
+{
+   const auto eps32 = std::pow(10.0f, -std::numeric_limits<float>::digits10);
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Cl2.txt");
+   const auto fixed_values = polylogarithm::test::read_reals_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      // compare to double precision at the same argument
+      const auto x32 = static_cast<float>(v.first);
+      const auto cl32 = polylogarithm::Cl2(x32);
+      const auto cl32_expected = static_cast<float>(polylogarithm::Cl2(static_cast<double>(x32)));
+
+      INFO("x(32)         = " << x32);
+      INFO("Cl2(32)  real = " << cl32_expected << " (expected)");
+      INFO("Cl2(32)  real = " << cl32          << " (polylogarithm C++)");
+
+      CHECK_CLOSE(cl32, cl32_expected, 2*eps32);
+   }
+
+   for (const auto x: float_range(-10., 10., 1000)) {
+      const auto x32 = static_cast<float>(x);
+      INFO("x(32)         = " << x32);
+      CHECK_CLOSE(polylogarithm::Cl2(x32), static_cast<float>(polylogarithm::Cl2(static_cast<double>(x32))), 2*eps32);
+   }
+}
+
+TEST_CASE("test_fast")
+{
+   const double eps = 1e-10;
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Cl2.txt");
+   const auto fixed_values = polylogarithm::test::read_reals_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      const auto x64 = static_cast<double>(v.first);
+      const auto cl64_expected = static_cast<double>(v.second);
+
+      INFO("x(64)         = " << x64);
+      CHECK_CLOSE(polylogarithm::Cl2_fast(x64), cl64_expected, eps);
+   }
+
+   for (const auto x: float_range(-10., 10., 10000)) {
+      INFO("x(64)         = " << x);
+      CHECK_CLOSE(polylogarithm::Cl2_fast(x), polylogarithm::Cl2(x), eps);
+   }
+}
+
+TEST_CASE("test_c_batch")
+{
+   polylogarithm::test::check_real_batch<double>(cl2_v, cl2);
+   polylogarithm::test::check_real_batch<long double>(cl2l_v, cl2l);
+}
+
+#ifdef ENABLE_FORTRAN
+
+TEST_CASE("test_fortran_batch")
+{
+   polylogarithm::test::check_real_batch<double>(cl2_fortran_v, cl2_fortran);
+}
+
+#endif
@@ -0,0 +1,95 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Cl2.hpp"
+#include "Cl2Table.hpp"
+#include "read_data.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+#define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
+
+TEST_CASE("test_layout")
+{
+   for (const std::size_t n: { 0, 1, 16, 512, 1000 }) {
+      const polylogarithm::Cl2Table table(n);
+      const std::size_t n_seg = n == 0 ? 1 : n;
+
+      CHECK(table.segments() == n_seg);
+      CHECK(table.lower_bound() > 0);
+      CHECK(table.lower_bound() < 3.1415926535897932);
+      CHECK(table.memory_footprint() >= n_seg*polylogarithm::Cl2Table::n_coeffs*sizeof(double));
+   }
+}
+
+TEST_CASE("test_fixed_values")
+{
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Cl2.txt");
+   const auto values = polylogarithm::test::read_reals_from_file<long double>(filename);
+
+   for (const std::size_t n: { 1, 16, 512, 4096 }) {
+      const polylogarithm::Cl2Table table(n);
+
+      for (auto v: values) {
+         const auto x = static_cast<double>(v.first);
+         const auto cl2_expected = static_cast<double>(v.second);
+         INFO("n = " << n << ", x = " << x);
+         CHECK_CLOSE(table(x), cl2_expected, 1e-14);
+      }
+   }
+}
+
+TEST_CASE("test_random_values")
+{
+   using polylogarithm::bench::generate_random_scalars;
+
+   const polylogarithm::Cl2Table table;
+   const auto x = generate_random_scalars<double>(100000, -20, 20);
+   const auto cl2 = table(x);
+
+   REQUIRE(cl2.size() == x.size());
+
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      INFO("x = " << x[i]);
+      CHECK_CLOSE(cl2[i], polylogarithm::Cl2(x[i]), 1e-14);
+      CHECK(cl2[i] == table(x[i]));
+   }
+}
+
+TEST_CASE("test_segment_boundaries")
+{
+   const polylogarithm::Cl2Table table(64);
+   const double x0 = table.lower_bound();
+   const double h = (3.1415926535897932 - x0)/table.segments();
+
+   for (std::size_t i = 0; i <= table.segments(); ++i) {
+      const double x = x0 + i*h;
+      for (const double dx: { -1e-12, 0.0, 1e-12 }) {
+         INFO("x = " << x + dx);
+         CHECK_CLOSE(table(x + dx), polylogarithm::Cl2(x + dx), 1e-14);
+      }
+   }
+}
+
+
+TEST_CASE("test_non_finite")
+{
+   const polylogarithm::Cl2Table table(64);
+   const double inf = std::numeric_limits<double>::infinity();
+   const double nan = std::numeric_limits<double>::quiet_NaN();
+   const double x[] = { nan, inf, -inf };
+   double cl2[3] = { 0, 0, 0 };
+
+   table(x, cl2, 3);
+
+   for (int i = 0; i < 3; ++i) {
+      INFO("x = " << x[i]);
+      CHECK(std::isnan(table(x[i])));
+      CHECK(std::isnan(cl2[i]));
+      CHECK(std::isnan(polylogarithm::Cl2(x[i])));
+   }
+}
@@ -5,6 +5,7 @@
 #include "Cl5.hpp"
 #include "fortran_wrappers.h"
 #include "Li5.hpp"
+#include "check_batch.hpp"
 #include "read_data.hpp"
 #include <cmath>
 #include <complex>
@@ -125,3 +126,44 @@ TEST_CASE("test_real_fixed_values")
       CHECK_CLOSE(cl128_poly_c, cl128_expected, 7*eps128);
    }
 }
+
+TEST_CASE("test_single_precision")
+{
+   const auto eps32 = std::pow(10.0f, -std::numeric_limits<float>::digits10);
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Cl5.txt");
+   const auto fixed_values = polylogarithm::test::read_reals_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      // compare to double precision at the same argument
+      const auto x32 = static_cast<float>(v.first);
+      const auto cl32 = polylogarithm::Cl5(x32);
+      const auto cl32_expected = static_cast<float>(polylogarithm::Cl5(static_cast<double>(x32)));
+
+      INFO("x(32)         = " << x32);
+      INFO("Cl5(32)  real = " << cl32_expected << " (expected)");
+      INFO("Cl5(32)  real = " << cl32          << " (polylogarithm C++)");
+
+      CHECK_CLOSE(cl32, cl32_expected, 2*eps32);
+   }
+
+   for (const auto x: float_range(-10., 10., 1000)) {
+      const auto x32 = static_cast<float>(x);
+      INFO("x(32)         = " << x32);
+      CHECK_CLOSE(polylogarithm::Cl5(x32), static_cast<float>(polylogarithm::Cl5(static_cast<double>(x32))), 2*eps32);
+   }
+}
+
+TEST_CASE("test_c_batch")
+{
+   polylogarithm::test::check_real_batch<double>(cl5_v, cl5);
+   polylogarithm::test::check_real_batch<long double>(cl5l_v, cl5l);
+}
+
+#ifdef ENABLE_FORTRAN
+
+TEST_CASE("test_fortran_batch")
+{
+   polylogarithm::test::check_real_batch<double>(cl5_fortran_v, cl5_fortran);
+}
+
+#endif
@@ -0,0 +1,56 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Cl1.hpp"
+#include "Cl2.hpp"
+#include "Cl3.hpp"
+#include "Cl4.hpp"
+#include "Cl5.hpp"
+#include "Cl6.hpp"
+#include "Cl_all.hpp"
+#include "read_data.hpp"
+#include <cmath>
+#include <string>
+
+TEST_CASE("test_real_fixed_values")
+{
+   using polylogarithm::Cl_all;
+
+   double (*cl_n[])(double) = {
+      polylogarithm::Cl1, polylogarithm::Cl2, polylogarithm::Cl3,
+      polylogarithm::Cl4, polylogarithm::Cl5, polylogarithm::Cl6
+   };
+
+   for (int n = 1; n <= 6; ++n) {
+      const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Cl" + std::to_string(n) + ".txt");
+      const auto values = polylogarithm::test::read_reals_from_file<long double>(filename);
+
+      for (auto v: values) {
+         const auto x = static_cast<double>(v.first);
+         INFO("n = " << n << ", x = " << x);
+         CHECK(Cl_all(x)[n - 1] == cl_n[n - 1](x));
+      }
+   }
+}
+
+TEST_CASE("test_real_random_values")
+{
+   using polylogarithm::bench::generate_random_scalars;
+
+   const double pi = 3.1415926535897932;
+   auto values = generate_random_scalars<double>(10000, -8*pi, 8*pi);
+   const double specials[] = { 0.0, pi/2, pi, -pi, 2*pi, 3*pi/2 };
+   values.insert(values.end(), std::begin(specials), std::end(specials));
+
+   for (auto x: values) {
+      const auto cl = polylogarithm::Cl_all(x);
+      INFO("x = " << x);
+      CHECK(cl[0] == polylogarithm::Cl1(x));
+      CHECK(cl[1] == polylogarithm::Cl2(x));
+      CHECK(cl[2] == polylogarithm::Cl3(x));
+      CHECK(cl[3] == polylogarithm::Cl4(x));
+      CHECK(cl[4] == polylogarithm::Cl5(x));
+      CHECK(cl[5] == polylogarithm::Cl6(x));
+   }
+}
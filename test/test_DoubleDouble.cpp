@@ -0,0 +1,101 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "DoubleDouble.hpp"
+#include <cmath>
+
+using polylogarithm::DoubleDouble;
+
+namespace {
+
+/// relative difference of a and b, measured relative to max(|b|, 1)
+double rel_diff(const DoubleDouble& a, const DoubleDouble& b)
+{
+   const double scale = std::fmax(std::abs(b.hi), 1.0);
+   return std::abs((a - b).hi)/scale;
+}
+
+} // anonymous namespace
+
+#define CHECK_DD(a,b,eps) do {                                          \
+      INFO(#a << " = " << (a).hi << " + " << (a).lo);                   \
+      CHECK(rel_diff((a), (b)) <= (eps));                               \
+   } while (0)
+
+TEST_CASE("test_representation")
+{
+   const DoubleDouble third = DoubleDouble(1.0)/3.0;
+
+   // hi + lo is a non-overlapping sum
+   CHECK(third.hi == 1.0/3.0);
+   CHECK(third.hi + third.lo == third.hi);
+   CHECK(static_cast<double>(third) == third.hi);
+}
+
+TEST_CASE("test_arithmetic")
+{
+   const double eps = 1e-31;
+   const DoubleDouble one(1.0);
+
+   CHECK_DD(one/3.0, DoubleDouble(3.33333333333333315e-01, 1.85037170770859413e-17), eps);
+   CHECK_DD(one/DoubleDouble(3.0), DoubleDouble(3.33333333333333315e-01, 1.85037170770859413e-17), eps);
+   CHECK_DD((one/3.0)*3.0, one, eps);
+   CHECK_DD((one/7.0)*DoubleDouble(7.0), one, eps);
+   CHECK_DD((one/3.0 + one/6.0)*2.0, one, eps);
+   CHECK_DD(1.0 - (one/3.0 + one/3.0 + one/3.0), DoubleDouble(), eps);
+
+   // 2^(-60) is not representable in 1 + 2^(-60) as a double
+   const DoubleDouble x = one + std::ldexp(1.0, -60);
+   CHECK(x.hi == 1.0);
+   CHECK(x.lo == std::ldexp(1.0, -60));
+   CHECK((x - 1.0).hi == std::ldexp(1.0, -60));
+   CHECK(x > one);
+   CHECK(x > 1.0);
+   CHECK(one < x);
+   CHECK(-x < -1.0);
+}
+
+TEST_CASE("test_elementary_functions")
+{
+   const double eps = 1e-30;
+   const DoubleDouble one(1.0);
+
+   CHECK_DD(sqrt(DoubleDouble(2.0)), DoubleDouble(1.41421356237309515e+00, -9.66729331345291345e-17), eps);
+   CHECK_DD(exp(one), DoubleDouble(2.71828182845904509e+00, 1.44564689172925016e-16), eps);
+   CHECK_DD(exp(DoubleDouble(-10.5)), DoubleDouble(2.75364493497471581e-05, -2.49918966833976588e-22), eps);
+   CHECK_DD(exp(DoubleDouble(0.125)), DoubleDouble(1.13314845306682632e+00, -5.37073770855803120e-18), eps);
+   CHECK_DD(log(DoubleDouble(2.0)), DoubleDouble(6.93147180559945286e-01, 2.31904681384629956e-17), eps);
+   CHECK_DD(log(DoubleDouble(10.0)), DoubleDouble(2.30258509299404590e+00, -2.17075622338224935e-16), eps);
+   CHECK_DD(log(DoubleDouble(0.001)), DoubleDouble(-6.90775527898213682e+00, -2.16134870973728717e-16), eps);
+   CHECK_DD(log1p(DoubleDouble(1e-10)), DoubleDouble(9.99999999950000070e-11, -3.38951332212179423e-27), eps);
+   CHECK_DD(log1p(DoubleDouble(-0.5)), DoubleDouble(-6.93147180559945286e-01, -2.31904681384629956e-17), eps);
+   CHECK_DD(sin(one), DoubleDouble(8.41470984807896505e-01, 1.77684509293553611e-18), eps);
+   CHECK_DD(cos(one), DoubleDouble(5.40302305868139765e-01, -4.76095461260441722e-17), eps);
+   CHECK_DD(sin(DoubleDouble(100.0)), DoubleDouble(-5.06365641109758791e-01, -3.05094705379211491e-18), eps);
+   CHECK_DD(cos(DoubleDouble(100.0)), DoubleDouble(8.62318872287683891e-01, 4.33480985813650085e-17), eps);
+   CHECK_DD(sin(DoubleDouble(-2.5)), DoubleDouble(-5.98472144103956549e-01, 5.52140333408237487e-17), eps);
+   CHECK_DD(atan2(one, DoubleDouble(3.0)), DoubleDouble(3.21750554396642185e-01, 7.91739252572214309e-18), eps);
+   CHECK_DD(atan2(-one, DoubleDouble(-3.0)), DoubleDouble(-2.81984209919315099e+00, -5.90361361577553506e-17), eps);
+   CHECK_DD(atan2(DoubleDouble(2.0), DoubleDouble(0.5)), DoubleDouble(1.32581766366803255e+00, -8.82442937395113632e-17), eps);
+   CHECK_DD(hypot(DoubleDouble(3.0), DoubleDouble(4.5)), DoubleDouble(5.40832691319598435e+00, -4.13743031587414387e-16), eps);
+
+   // identities
+   for (const double x: { -20.0, -3.3, -0.7, 0.01, 0.5, 1.9, 7.25, 30.0 }) {
+      const DoubleDouble y(x);
+      DoubleDouble s, c;
+      sincos(y, s, c);
+      CHECK_DD(log(exp(y)), y, eps);
+      CHECK_DD(s*s + c*c, one, eps);
+      CHECK_DD(s, sin(y), 0.0);
+      CHECK_DD(c, cos(y), 0.0);
+      if (std::abs(x) < 3) {
+         CHECK_DD(atan2(s, c), y, eps);
+      }
+   }
+
+   CHECK(isnan(sqrt(DoubleDouble(-1.0))));
+   CHECK(exp(DoubleDouble()) == 1.0);
+   CHECK(log(one) == 0.0);
+   CHECK(fabs(DoubleDouble(-2.0, 1e-20)) == DoubleDouble(2.0, -1e-20));
+   CHECK(ldexp(DoubleDouble(1.5, 1e-20), 3) == DoubleDouble(12.0, 8e-20));
+}
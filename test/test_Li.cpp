@@ -6,6 +6,7 @@
 #include <cmath>
 #include <complex>
 #include <string>
+#include <vector>
 
 #define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
 
@@ -78,6 +79,40 @@ TEST_CASE("test_complex_fixed_values")
    CHECK_CLOSE_COMPLEX(Li(10, -z), std::complex<double>(-1.4978556954869267594, 0.0), 1e-14);
 }
 
+TEST_CASE("test_negative_order_large_argument")
+{
+   using polylogarithm::Li;
+
+   // Li_{-n}(z) = z A_n(z)/(1 - z)^(n + 1) with Eulerian polynomial A_n
+   const auto li_m2 = [] (std::complex<double> z) {
+      return z*(1.0 + z)/std::pow(1.0 - z, 3);
+   };
+   const auto li_m3 = [] (std::complex<double> z) {
+      return z*(1.0 + z*(4.0 + z))/std::pow(1.0 - z, 4);
+   };
+
+   const std::complex<double> zs[] = {
+      {-30.0, 0.0}, {30.0, 1.0}, {-20.0, 15.0}, {5.0, -40.0}, {1e3, 1e3}, {-1e5, 1.0}
+   };
+
+   for (const auto z: zs) {
+      INFO("z = " << z);
+      CHECK_CLOSE_COMPLEX(Li(-2, z), li_m2(z), 1e-13);
+      CHECK_CLOSE_COMPLEX(Li(-3, z), li_m3(z), 1e-13);
+   }
+}
+
+TEST_CASE("test_negative_order_large_weights")
+{
+   using polylogarithm::Li;
+
+   // the weights k^|n| of the series overflow, but the terms do not
+   // generated with mpmath: polylog(n, z)
+   CHECK_CLOSE(std::real(Li(-200, 0.01)), 3.841546398404262399e+241, 1e-13);
+   CHECK_CLOSE_COMPLEX(Li(-200, std::complex<double>(0.01, 0.005)),
+                       std::complex<double>(-4.4577332914364270324e+242, 1.7782899248508063329e+243), 1e-13);
+}
+
 template<typename T>
 struct Data {
    int n;
@@ -101,3 +136,51 @@ TEST_CASE("test_overflow")
       CHECK_CLOSE_COMPLEX(Li(d.n, d.z), d.li_expected, d.eps);
    }
 }
+
+TEST_CASE("test_compile_time_order")
+{
+   using polylogarithm::Li;
+
+   const std::complex<double> zs[] = {
+      {0.5, 0.5}, {-0.7, 0.2}, {1.2, -0.3}, {-3.0, 4.0}, {0.9, 0.0}, {2.0, 0.0}
+   };
+
+   for (const auto z: zs) {
+      INFO("z = " << z);
+      CHECK(Li<-3>(z) == Li(-3, z));
+      CHECK(Li<0>(z) == Li(0, z));
+      CHECK(Li<1>(z) == Li(1, z));
+      CHECK(Li<2>(z) == Li(2, z));
+      CHECK(Li<3>(z) == Li(3, z));
+      CHECK(Li<4>(z) == Li(4, z));
+      CHECK(Li<5>(z) == Li(5, z));
+      CHECK(Li<6>(z) == Li(6, z));
+      CHECK(Li<7>(z) == Li(7, z));
+      CHECK(Li<10>(z) == Li(10, z));
+      CHECK(Li<33>(z) == Li(33, z));
+      CHECK(Li<64>(z) == Li(64, z));
+      CHECK(Li<65>(z) == Li(65, z));
+      CHECK(Li<100>(z) == Li(100, z));
+   }
+}
+
+TEST_CASE("test_batch")
+{
+   using polylogarithm::Li;
+
+   const std::vector<std::complex<double>> zs = {
+      {0.5, 0.5}, {-0.7, 0.2}, {1.2, -0.3}, {-3.0, 4.0}, {0.9, 0.0}, {2.0, 0.0},
+      {0.01, 0.02}, {-0.5, 0.0}, {1.0, 0.0}, {-1.0, 0.0}, {0.0, 0.0}
+   };
+   const int ni[] = { -10, -2, 0, 3, 7, 10, 100 };
+
+   for (const auto n: ni) {
+      std::vector<std::complex<double>> li(zs.size());
+      Li(n, zs.data(), li.data(), zs.size());
+
+      for (std::size_t i = 0; i < zs.size(); ++i) {
+         INFO("n = " << n << ", z = " << zs[i]);
+         CHECK(li[i] == Li(n, zs[i]));
+      }
+   }
+}
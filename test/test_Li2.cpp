@@ -6,6 +6,7 @@
 #include "c_wrappers.h"
 #include "fortran_wrappers.h"
 #include "Li2.hpp"
+#include "check_batch.hpp"
 #include "read_data.hpp"
 #include <cmath>
 #include <complex>
@@ -617,6 +618,24 @@ TEST_CASE("test_real_random_values")
    }
 }
 
+TEST_CASE("test_real_batch")
+{
+   using polylogarithm::bench::generate_random_scalars;
+
+   auto values = generate_random_scalars<double>(10000, -10, 10);
+   const double specials[] = { -1.5, -1.0, -0.5, -0.0, 0.0, 0.5, 1.0, 1.5, 2.0, 1e300, -1e300 };
+   values.insert(values.end(), std::begin(specials), std::end(specials));
+
+   const std::vector<double> li2 = polylogarithm::Li2(values);
+
+   REQUIRE(li2.size() == values.size());
+
+   for (std::size_t i = 0; i < values.size(); ++i) {
+      INFO("x = " << values[i]);
+      CHECK(li2[i] == polylogarithm::Li2(values[i]));
+   }
+}
+
 TEST_CASE("test_complex_random_values")
 {
    using polylogarithm::bench::generate_random_complexes;
@@ -672,6 +691,34 @@ TEST_CASE("test_complex_random_values")
    }
 }
 
+TEST_CASE("test_complex_batch")
+{
+   using polylogarithm::bench::generate_random_complexes;
+
+   const auto eps = std::pow(10.0, -std::numeric_limits<double>::digits10);
+   auto values = generate_random_complexes<double>(10000, -10, 10);
+   values.insert(values.end(), special_values.begin(), special_values.end());
+   values.push_back({-1.08371e-08, 1.32716e-24});
+   values.push_back({1e300, 1.0});
+   values.push_back({1.0, 1e300});
+
+   const std::size_t n = values.size();
+   std::vector<double> re(n), im(n), li2_re(n), li2_im(n);
+
+   for (std::size_t i = 0; i < n; ++i) {
+      re[i] = std::real(values[i]);
+      im[i] = std::imag(values[i]);
+   }
+
+   polylogarithm::Li2(re.data(), im.data(), li2_re.data(), li2_im.data(), n);
+
+   for (std::size_t i = 0; i < n; ++i) {
+      INFO("z = " << values[i]);
+      CHECK_CLOSE_COMPLEX(std::complex<double>(li2_re[i], li2_im[i]),
+                          polylogarithm::Li2(values[i]), eps);
+   }
+}
+
 TEST_CASE("test_relations")
 {
    const double eps = 2*std::pow(10.0, -std::numeric_limits<double>::digits10);
@@ -684,3 +731,49 @@ TEST_CASE("test_relations")
       CHECK_SMALL(Relation_5(v), eps);
    }
 }
+
+TEST_CASE("test_fast")
+{
+   const double eps = 1e-10;
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Li2.txt");
+   const auto fixed_values = polylogarithm::test::read_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      if (std::imag(v.first) != 0.0L) {
+         continue;
+      }
+
+      const auto x64 = static_cast<double>(std::real(v.first));
+      const auto li64_expected = static_cast<double>(std::real(v.second));
+
+      INFO("x(64)         = " << x64);
+      CHECK_CLOSE(polylogarithm::Li2_fast(x64), li64_expected, eps);
+   }
+
+   const auto values = polylogarithm::bench::generate_random_scalars<double>(10000, -100, 100);
+
+   for (const auto x: values) {
+      INFO("x(64)         = " << x);
+      CHECK_CLOSE(polylogarithm::Li2_fast(x), polylogarithm::Li2(x), eps);
+   }
+}
+
+TEST_CASE("test_c_batch")
+{
+   polylogarithm::test::check_real_batch<float>(li2f_v, li2f);
+   polylogarithm::test::check_real_batch<double>(li2_v, li2);
+   polylogarithm::test::check_real_batch<long double>(li2l_v, li2l);
+   polylogarithm::test::check_complex_batch<float>(cli2f_v, cli2f_c);
+   polylogarithm::test::check_complex_batch<double>(cli2_v, cli2_c);
+   polylogarithm::test::check_complex_batch<long double>(cli2l_v, cli2l_c);
+}
+
+#ifdef ENABLE_FORTRAN
+
+TEST_CASE("test_fortran_batch")
+{
+   polylogarithm::test::check_real_batch<double>(li2_fortran_v, li2_fortran);
+   polylogarithm::test::check_complex_batch<double>(cli2_fortran_v, cli2_fortran);
+}
+
+#endif
@@ -6,10 +6,12 @@
 #include "fortran_wrappers.h"
 #include "Li3.hpp"
 #include "bench.hpp"
+#include "check_batch.hpp"
 #include "read_data.hpp"
 #include <cmath>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #ifndef M_PI
 #define M_PI 3.1415926535897932
@@ -301,3 +303,84 @@ TEST_CASE("test_complex_random_values")
 #endif
    }
 }
+
+TEST_CASE("test_single_precision")
+{
+   const auto eps32 = std::pow(10.0f, -std::numeric_limits<float>::digits10);
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Li3.txt");
+   const auto fixed_values = polylogarithm::test::read_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      const auto z32 = to<float>(v.first);
+
+      // compare to double precision at the same argument
+      const auto z64 = to<double>(z32);
+      const auto li32 = polylogarithm::Li3(z32);
+      const auto li32_expected = to<float>(polylogarithm::Li3(z64));
+
+      INFO("z(32)         = " << z32);
+      INFO("Li3(32)  cmpl = " << li32_expected << " (expected)");
+      INFO("Li3(32)  cmpl = " << li32          << " (polylogarithm C++)");
+
+      CHECK_CLOSE_COMPLEX(li32, li32_expected, 2*eps32);
+
+      if (std::imag(z32) == 0.0f) {
+         const auto x32 = std::real(z32);
+         CHECK_CLOSE(polylogarithm::Li3(x32), static_cast<float>(polylogarithm::Li3(static_cast<double>(x32))), 2*eps32);
+      }
+   }
+}
+
+TEST_CASE("test_fast")
+{
+   const double eps = 5e-10;
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Li3.txt");
+   const auto fixed_values = polylogarithm::test::read_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      if (std::imag(v.first) != 0.0L) {
+         continue;
+      }
+
+      const auto x64 = static_cast<double>(std::real(v.first));
+      const auto li64_expected = static_cast<double>(std::real(v.second));
+
+      INFO("x(64)         = " << x64);
+      CHECK_CLOSE(polylogarithm::Li3_fast(x64), li64_expected, eps);
+   }
+
+   const auto values = polylogarithm::bench::generate_random_scalars<double>(10000, -100, 100);
+
+   for (const auto x: values) {
+      INFO("x(64)         = " << x);
+      CHECK_CLOSE(polylogarithm::Li3_fast(x), polylogarithm::Li3(x), eps);
+   }
+}
+
+TEST_CASE("test_integral_arguments")
+{
+   // integer literals are evaluated in double precision
+   for (const int x: { -10, -1, 0, 1, 2, 10 }) {
+      CHECK(polylogarithm::Li3(x) == polylogarithm::Li3(static_cast<double>(x)));
+   }
+
+   CHECK(polylogarithm::Li3(1L) == polylogarithm::Li3(1.0));
+   CHECK(polylogarithm::Li3(2u) == polylogarithm::Li3(2.0));
+}
+
+TEST_CASE("test_c_batch")
+{
+   polylogarithm::test::check_real_batch<double>(li3_v, li3);
+   polylogarithm::test::check_complex_batch<double>(cli3_v, cli3_c);
+   polylogarithm::test::check_complex_batch<long double>(cli3l_v, cli3l_c);
+}
+
+#ifdef ENABLE_FORTRAN
+
+TEST_CASE("test_fortran_batch")
+{
+   polylogarithm::test::check_real_batch<double>(li3_fortran_v, li3_fortran);
+   polylogarithm::test::check_complex_batch<double>(cli3_fortran_v, cli3_fortran);
+}
+
+#endif
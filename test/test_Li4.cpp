@@ -5,10 +5,12 @@
 #include "c_wrappers.h"
 #include "fortran_wrappers.h"
 #include "Li4.hpp"
+#include "check_batch.hpp"
 #include "read_data.hpp"
 #include <cmath>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #ifndef M_PI
 #define M_PI 3.1415926535897932
@@ -195,3 +197,58 @@ TEST_CASE("test_complex_fixed_values")
       CHECK_CLOSE_COMPLEX(li128_cmpl_c, li128_expected, 2*eps128);
    }
 }
+
+TEST_CASE("test_single_precision")
+{
+   const auto eps32 = std::pow(10.0f, -std::numeric_limits<float>::digits10);
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Li4.txt");
+   const auto fixed_values = polylogarithm::test::read_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      const auto z32 = to<float>(v.first);
+
+      // compare to double precision at the same argument
+      const auto z64 = to<double>(z32);
+      const auto li32 = polylogarithm::Li4(z32);
+      const auto li32_expected = to<float>(polylogarithm::Li4(z64));
+
+      INFO("z(32)         = " << z32);
+      INFO("Li4(32)  cmpl = " << li32_expected << " (expected)");
+      INFO("Li4(32)  cmpl = " << li32          << " (polylogarithm C++)");
+
+      CHECK_CLOSE_COMPLEX(li32, li32_expected, 2*eps32);
+
+      if (std::imag(z32) == 0.0f) {
+         const auto x32 = std::real(z32);
+         CHECK_CLOSE(polylogarithm::Li4(x32), static_cast<float>(polylogarithm::Li4(static_cast<double>(x32))), 2*eps32);
+      }
+   }
+}
+
+TEST_CASE("test_integral_arguments")
+{
+   // integer literals are evaluated in double precision
+   for (const int x: { -10, -1, 0, 1, 2, 10 }) {
+      CHECK(polylogarithm::Li4(x) == polylogarithm::Li4(static_cast<double>(x)));
+   }
+
+   CHECK(polylogarithm::Li4(1L) == polylogarithm::Li4(1.0));
+   CHECK(polylogarithm::Li4(2u) == polylogarithm::Li4(2.0));
+}
+
+TEST_CASE("test_c_batch")
+{
+   polylogarithm::test::check_real_batch<double>(li4_v, li4);
+   polylogarithm::test::check_complex_batch<double>(cli4_v, cli4_c);
+   polylogarithm::test::check_complex_batch<long double>(cli4l_v, cli4l_c);
+}
+
+#ifdef ENABLE_FORTRAN
+
+TEST_CASE("test_fortran_batch")
+{
+   polylogarithm::test::check_real_batch<double>(li4_fortran_v, li4_fortran);
+   polylogarithm::test::check_complex_batch<double>(cli4_fortran_v, cli4_fortran);
+}
+
+#endif
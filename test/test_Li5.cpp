@@ -5,10 +5,12 @@
 #include "c_wrappers.h"
 #include "fortran_wrappers.h"
 #include "Li5.hpp"
+#include "check_batch.hpp"
 #include "read_data.hpp"
 #include <cmath>
 #include <limits>
 #include <utility>
+#include <vector>
 
 #define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
 #define CHECK_CLOSE_COMPLEX(a,b,eps) do {                               \
@@ -143,3 +145,40 @@ TEST_CASE("test_fixed_values")
       CHECK_CLOSE_COMPLEX(li128_cmpl_c, li128_expected, 2*eps128);
    }
 }
+
+TEST_CASE("test_single_precision")
+{
+   const auto eps32 = std::pow(10.0f, -std::numeric_limits<float>::digits10);
+   const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Li5.txt");
+   const auto fixed_values = polylogarithm::test::read_from_file<long double>(filename);
+
+   for (auto v: fixed_values) {
+      const auto z32 = to<float>(v.first);
+
+      // compare to double precision at the same argument
+      const auto z64 = to<double>(z32);
+      const auto li32 = polylogarithm::Li5(z32);
+      const auto li32_expected = to<float>(polylogarithm::Li5(z64));
+
+      INFO("z(32)         = " << z32);
+      INFO("Li5(32)  cmpl = " << li32_expected << " (expected)");
+      INFO("Li5(32)  cmpl = " << li32          << " (polylogarithm C++)");
+
+      CHECK_CLOSE_COMPLEX(li32, li32_expected, 2*eps32);
+   }
+}
+
+TEST_CASE("test_c_batch")
+{
+   polylogarithm::test::check_complex_batch<double>(cli5_v, cli5_c);
+   polylogarithm::test::check_complex_batch<long double>(cli5l_v, cli5l_c);
+}
+
+#ifdef ENABLE_FORTRAN
+
+TEST_CASE("test_fortran_batch")
+{
+   polylogarithm::test::check_complex_batch<double>(cli5_fortran_v, cli5_fortran);
+}
+
+#endif
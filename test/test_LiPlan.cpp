@@ -0,0 +1,95 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Li.hpp"
+#include "LiPlan.hpp"
+#include "read_data.hpp"
+#include <cmath>
+#include <complex>
+#include <string>
+#include <vector>
+
+#define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
+
+#define CHECK_CLOSE_COMPLEX(a,b,eps) do {                               \
+      CHECK_CLOSE(std::real(a), std::real(b), (eps));                   \
+      CHECK_CLOSE(std::imag(a), std::imag(b), (eps));                   \
+   } while (0)
+
+TEST_CASE("test_complex_fixed_values")
+{
+   const int ni[] = { -10, -1, 0, 1, 2, 6, 100 };
+
+   for (const auto n: ni) {
+      const polylogarithm::LiPlan li(n);
+      const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Li" + std::to_string(n) + ".txt");
+      const auto values = polylogarithm::test::read_from_file<double>(filename);
+
+      for (auto v: values) {
+         const auto z = v.first;
+         INFO("n = " << n << ", z = " << z);
+         CHECK_CLOSE_COMPLEX(li(z), polylogarithm::Li(n, z), 1e-14);
+      }
+   }
+}
+
+TEST_CASE("test_complex_random_values")
+{
+   using polylogarithm::bench::generate_random_complexes;
+
+   const auto values = generate_random_complexes<double>(10000, -3, 3);
+
+   for (int n = 7; n <= 20; ++n) {
+      const polylogarithm::LiPlan li(n);
+      CHECK(li.order() == n);
+
+      const auto li_batch = li(values);
+      REQUIRE(li_batch.size() == values.size());
+
+      for (std::size_t i = 0; i < values.size(); ++i) {
+         const auto z = values[i];
+         const auto li_expected = polylogarithm::Li(n, z);
+         INFO("n = " << n << ", z = " << z);
+         CHECK_CLOSE_COMPLEX(li(z), li_expected, 1e-14);
+         CHECK(li_batch[i] == li(z));
+      }
+   }
+}
+
+TEST_CASE("test_special_values")
+{
+   const polylogarithm::LiPlan li(10);
+
+   CHECK(li(1.0) == polylogarithm::Li(10, 1.0));
+   CHECK(li(-1.0) == polylogarithm::Li(10, -1.0));
+   CHECK(li(0.0) == polylogarithm::Li(10, 0.0));
+   CHECK(std::isnan(std::real(li(std::complex<double>(std::nan(""), 0.0)))));
+   CHECK_CLOSE_COMPLEX(li(std::complex<double>(1e300, 1.0)),
+                       polylogarithm::Li(10, std::complex<double>(1e300, 1.0)), 1e-14);
+}
+
+TEST_CASE("test_large_order")
+{
+   using polylogarithm::bench::generate_random_complexes;
+
+   const auto values = generate_random_complexes<double>(1000, -2, 2);
+
+   for (const int64_t n: { 53, 54, 55, 56, 60, 100, 1000 }) {
+      const polylogarithm::LiPlan li(n);
+
+      for (const auto z: values) {
+         INFO("n = " << n << ", z = " << z);
+         CHECK_CLOSE_COMPLEX(li(z), polylogarithm::Li(n, z), 1e-14);
+      }
+   }
+
+   // the plan does not grow with n
+   const int64_t n = 50000000;
+   const polylogarithm::LiPlan li(n);
+   const std::complex<double> z(0.5, 0.25);
+   std::complex<double> out;
+   polylogarithm::Li(n, &z, &out, 1);
+   CHECK(li(z) == polylogarithm::Li(n, z));
+   CHECK(out == polylogarithm::Li(n, z));
+}
@@ -0,0 +1,59 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Li2.hpp"
+#include "Li3.hpp"
+#include "Li4.hpp"
+#include "Li5.hpp"
+#include "Li6.hpp"
+#include "Li_all.hpp"
+#include "read_data.hpp"
+#include <cmath>
+#include <complex>
+#include <string>
+
+#define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
+
+#define CHECK_CLOSE_COMPLEX(a,b,eps) do {                               \
+      CHECK_CLOSE(std::real(a), std::real(b), (eps));                   \
+      CHECK_CLOSE(std::imag(a), std::imag(b), (eps));                   \
+   } while (0)
+
+TEST_CASE("test_complex_fixed_values")
+{
+   using polylogarithm::Li_all;
+
+   const double eps = 1e-14;
+
+   for (int n = 2; n <= 6; ++n) {
+      const std::string filename(std::string(TEST_DATA_DIR) + PATH_SEPARATOR + "Li" + std::to_string(n) + ".txt");
+      const auto values = polylogarithm::test::read_from_file<double>(filename);
+
+      for (auto v: values) {
+         const auto z = v.first;
+         const auto li_expected = v.second;
+         const auto li = Li_all(z);
+         INFO("n = " << n << ", z = " << z);
+         CHECK_CLOSE_COMPLEX(li[n - 2], li_expected, eps);
+      }
+   }
+}
+
+TEST_CASE("test_complex_random_values")
+{
+   using polylogarithm::bench::generate_random_complexes;
+
+   const double eps = 1e-14;
+   const auto values = generate_random_complexes<double>(10000, -5, 5);
+
+   for (auto z: values) {
+      const auto li = polylogarithm::Li_all(z);
+      INFO("z = " << z);
+      CHECK_CLOSE_COMPLEX(li[0], polylogarithm::Li2(z), eps);
+      CHECK_CLOSE_COMPLEX(li[1], polylogarithm::Li3(z), eps);
+      CHECK_CLOSE_COMPLEX(li[2], polylogarithm::Li4(z), eps);
+      CHECK_CLOSE_COMPLEX(li[3], polylogarithm::Li5(z), eps);
+      CHECK_CLOSE_COMPLEX(li[4], polylogarithm::Li6(z), eps);
+   }
+}
@@ -0,0 +1,278 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Cl2.hpp"
+#include "Cl3.hpp"
+#include "Cl4.hpp"
+#include "Cl5.hpp"
+#include "Cl6.hpp"
+#include "Li2.hpp"
+#include "Li3.hpp"
+#include "Li4.hpp"
+#include "Li5.hpp"
+#include "Li6.hpp"
+#include "Li_dd.hpp"
+#include <cmath>
+#include <complex>
+#include <utility>
+#include <vector>
+
+#define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
+
+#define CHECK_CLOSE_COMPLEX(a,b,eps) do {                               \
+      CHECK_CLOSE(std::real(a), std::real(b), (eps));                   \
+      CHECK_CLOSE(std::imag(a), std::imag(b), (eps));                   \
+   } while (0)
+
+using polylogarithm::DoubleDouble;
+using C = polylogarithm::Complex<DoubleDouble>;
+
+namespace {
+
+/// relative difference of a and b, measured relative to max(|b|, 1)
+double rel_diff(const DoubleDouble& a, const DoubleDouble& b)
+{
+   const double scale = std::fmax(std::abs(b.hi), 1.0);
+   return std::abs((a - b).hi)/scale;
+}
+
+std::complex<double> to_complex(const C& z)
+{
+   return { static_cast<double>(z.re), static_cast<double>(z.im) };
+}
+
+template <typename Fn>
+void check_values(Fn f, const std::vector<std::pair<C, C>>& values, double eps)
+{
+   for (const auto& v: values) {
+      const C z = v.first;
+      const C li = f(z);
+      INFO("z = (" << z.re.hi << ", " << z.im.hi << ")");
+      INFO("Li = (" << li.re.hi << " + " << li.re.lo << ", " << li.im.hi << " + " << li.im.lo << ")");
+      CHECK(rel_diff(li.re, v.second.re) <= eps);
+      CHECK(rel_diff(li.im, v.second.im) <= eps);
+   }
+}
+
+template <typename Fn>
+void check_values(Fn f, const std::vector<std::pair<double, DoubleDouble>>& values, double eps)
+{
+   for (const auto& v: values) {
+      const DoubleDouble y = f(DoubleDouble(v.first));
+      INFO("x = " << v.first << ", f(x) = " << y.hi << " + " << y.lo);
+      CHECK(rel_diff(y, v.second) <= eps);
+   }
+}
+
+} // anonymous namespace
+
+TEST_CASE("test_real_Li2")
+{
+   using polylogarithm::Li2;
+
+   // generated with mpmath: polylog(2, x)
+   check_values([] (const DoubleDouble& x) { return Li2(x); }, {
+      { -10.0, { -4.19827788685810344e+00, -4.21971297316069334e-16 } },
+      { -1.0, { -8.22467033424113203e-01, -1.52033617519923808e-17 } },
+      { -0.3, { -2.80074333759582905e-01, 1.07025510909151235e-17 } },
+      { 0.25, { 2.67652639082732624e-01, -1.71348335500242590e-17 } },
+      { 0.7, { 8.89377624286038615e-01, 4.72436074177314916e-17 } },
+      { 1.0, { 1.64493406684822641e+00, 3.04067235039847616e-17 } },
+      { 1.5, { 2.37439527027248021e+00, -6.61893963978150038e-18 } },
+      { 3.0, { 2.32018042331309848e+00, -8.69559879044837400e-17 } },
+      { 100.0, { -7.32395319900048225e+00, 7.64528891991233531e-18 } }
+   }, 1e-31);
+}
+
+TEST_CASE("test_complex_fixed_values")
+{
+   using polylogarithm::Li2;
+   using polylogarithm::Li3;
+   using polylogarithm::Li4;
+   using polylogarithm::Li5;
+   using polylogarithm::Li6;
+
+   const double eps = 1e-30;
+
+   // generated with mpmath: polylog(n, z), with Im = -pi*log(z)^(n-1)/(n-1)! for z > 1
+   check_values([] (const C& z) { return Li2(z); }, {
+      { C(0.3, 0.2), C({ 3.10452975621157035e-01, 2.33125430251030628e-17 }, { 2.35867921016975207e-01, 8.28296255981702554e-18 }) },
+      { C(-1.5, 0.7), C({ -1.18108583027324632e+00, -4.85514872279399606e-17 }, { 4.23120824905467485e-01, -1.04498154933136772e-17 }) },
+      { C(0.8, -0.4), C({ 8.81587791658611453e-01, 8.27133637057890051e-18 }, { -6.85071842886017524e-01, 8.83718255507951441e-18 }) },
+      { C(2.0, 1.0), C({ 1.18668853700005794e+00, -1.10271256802782174e-16 }, { 2.40774076934577197e+00, 3.22020895067418645e-17 }) },
+      { C(-5.0, -3.0), C({ -2.90971403539970286e+00, -4.57813740521904698e-17 }, { -1.03512179391099757e+00, -5.75452970630764350e-17 }) },
+      { C(0.5, 0.0), C({ 5.82240526465012453e-01, 5.24528686208041714e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(1.5, 0.0), C({ 2.37439527027248021e+00, -6.61893963978150038e-18 }, { -1.27380620491960062e+00, 8.44219480679185361e-17 }) },
+      { C(-0.25, 1e-10), C({ -2.35900297686263444e-01, -1.00702265200598106e-17 }, { 8.92574205256839106e-11, -5.04474001423955861e-27 }) },
+      { C(1e-20, 1e-20), C({ 9.99999999999999945e-21, -2.22222222222222173e-61 }, { 9.99999999999999945e-21, 4.99999999999999965e-41 }) },
+      { C(0.999, 0.001), C({ 1.63658670567752518e+00, 3.53361451092561344e-17 }, { 6.78284982771614961e-03, 2.65999445174957560e-19 }) },
+      { C(-1.0, 0.0), C({ -8.22467033424113203e-01, -1.52033617519923808e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(10.0, 0.5), C({ 3.77994736474730697e-01, -3.08484449092212438e-18 }, { 7.12786483133358661e+00, -7.44798296569185200e-18 }) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li3(z); }, {
+      { C(0.3, 0.2), C({ 3.05672369527297649e-01, 2.53123658546248381e-17 }, { 2.16894533836273024e-01, -1.10523867220807424e-17 }) },
+      { C(-1.5, 0.7), C({ -1.32268275931416146e+00, 7.62608737178694573e-17 }, { 5.33022294854851419e-01, 2.36744113699435632e-17 }) },
+      { C(0.8, -0.4), C({ 8.54711944026355752e-01, -3.32709624437075716e-17 }, { -5.18339888089548007e-01, 2.49698061206775789e-17 }) },
+      { C(2.0, 1.0), C({ 1.89018684728998854e+00, 9.93843198276590972e-17 }, { 1.84738717203210800e+00, -9.01217614959932462e-17 }) },
+      { C(-5.0, -3.0), C({ -3.70173371786478977e+00, 7.41387548667740371e-17 }, { -1.61751134499409077e+00, -8.09715945410492880e-17 }) },
+      { C(0.5, 0.0), C({ 5.37213193608040207e-01, -6.09818856073813341e-18 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(1.5, 0.0), C({ 2.06087750732028097e+00, -9.44951772938022983e-17 }, { -2.58241985293288234e-01, 2.35067163715131186e-17 }) },
+      { C(-0.25, 1e-10), C({ -2.42712003338916293e-01, -1.17361212215674927e-17 }, { 9.43601190745053810e-11, 3.95148987287035645e-27 }) },
+      { C(1e-20, 1e-20), C({ 9.99999999999999945e-21, -7.40740740740740636e-62 }, { 9.99999999999999945e-21, 2.49999999999999982e-41 }) },
+      { C(0.999, 0.001), C({ 1.20041274863286618e+00, 4.99939154704394047e-17 }, { 1.63851040117247125e-03, -4.73739689316857187e-20 }) },
+      { C(-1.0, 0.0), C({ -9.01542677369695733e-01, 1.89419686534113400e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(10.0, 0.5), C({ 5.28363876140045363e+00, 3.23093475032334009e-17 }, { 8.35999376787280291e+00, 1.26655996122107259e-16 }) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li4(z); }, {
+      { C(0.3, 0.2), C({ 3.02956109495369830e-01, -1.55722200086912632e-17 }, { 2.08115732468590858e-01, 1.38534220704378854e-17 }) },
+      { C(-1.5, 0.7), C({ -1.40473099146723968e+00, -7.82628646993260387e-17 }, { 6.04490853359693769e-01, 3.04436525196623859e-17 }) },
+      { C(0.8, -0.4), C({ 8.29614491774393281e-01, 2.19139300524127807e-17 }, { -4.51727484762487974e-01, -1.99409936907262889e-17 }) },
+      { C(2.0, 1.0), C({ 2.06459015126838930e+00, 1.08250130871629878e-16 }, { 1.41295054410386078e+00, 4.82766460556133195e-17 }) },
+      { C(-5.0, -3.0), C({ -4.24382278783901956e+00, 2.82788734628268539e-17 }, { -2.10138662475925075e+00, -1.28650261008366957e-16 }) },
+      { C(0.5, 0.0), C({ 5.17479061673899343e-01, 4.31540724007623914e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(1.5, 0.0), C({ 1.73475708077606217e+00, -9.20619994797459208e-17 }, { -3.49027048283366975e-02, -2.74486559360067738e-18 }) },
+      { C(-0.25, 1e-10), C({ -2.46272788760729056e-01, -8.81173067833618441e-18 }, { 9.70848013355665223e-11, 3.29474079110424560e-27 }) },
+      { C(1e-20, 1e-20), C({ 9.99999999999999945e-21, -2.46913580246913531e-62 }, { 9.99999999999999945e-21, 1.24999999999999991e-41 }) },
+      { C(0.999, 0.001), C({ 1.08112117850712730e+00, 1.00100892686494731e-16 }, { 1.20161624318292884e-03, 3.59783861538607766e-20 }) },
+      { C(-1.0, 0.0), C({ -9.47032829497245876e-01, -4.15494803749844393e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(10.0, 0.5), C({ 9.20395451923992169e+00, 4.80380305067884905e-16 }, { 6.67543703561083301e+00, 1.31651144513334151e-16 }) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li5(z); }, {
+      { C(0.3, 0.2), C({ 3.01511644615002128e-01, -2.18735940783706473e-18 }, { 2.03951253798444754e-01, -4.72597530002269717e-18 }) },
+      { C(-1.5, 0.7), C({ -1.45000649619456179e+00, -5.80139221157525843e-17 }, { 6.47436194849887126e-01, 1.50282698406916275e-17 }) },
+      { C(0.8, -0.4), C({ 8.15127125018262899e-01, -3.40415623213462607e-17 }, { -4.23634508381809771e-01, -7.31296846596332848e-18 }) },
+      { C(2.0, 1.0), C({ 2.06736901563944198e+00, -1.26014179583394753e-16 }, { 1.18616983515580610e+00, -6.25321689718695765e-17 }) },
+      { C(-5.0, -3.0), C({ -4.58030011306448959e+00, -2.94945150355969663e-16 }, { -2.45178734174642177e+00, 1.03801092715210690e-16 }) },
+      { C(0.5, 0.0), C({ 5.08400579242268669e-01, 3.87586758950480341e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(1.5, 0.0), C({ 1.59617394568135351e+00, -1.01802702742807545e-16 }, { -3.53795724662222264e-03, -1.44340257844446992e-19 }) },
+      { C(-0.25, 1e-10), C({ -2.48107645039782887e-01, 1.31602200151992232e-17 }, { 9.85091155042916336e-11, -4.24046156432513924e-27 }) },
+      { C(1e-20, 1e-20), C({ 9.99999999999999945e-21, -8.23045267489711805e-63 }, { 9.99999999999999945e-21, 6.24999999999999956e-42 }) },
+      { C(0.999, 0.001), C({ 1.03584543197654244e+00, 5.88872131112202544e-17 }, { 1.08220356771584255e-03, -8.03804210458670062e-20 }) },
+      { C(-1.0, 0.0), C({ -9.72119770446909337e-01, 3.10893214504126605e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(10.0, 0.5), C({ 1.09242958048799412e+01, -3.91499829117269363e-16 }, { 4.15783200870485459e+00, 2.70586481078674170e-16 }) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li6(z); }, {
+      { C(0.3, 0.2), C({ 3.00765569708624947e-01, 7.98142614376237592e-18 }, { 2.01941083323744636e-01, -9.92818991971917214e-18 }) },
+      { C(-1.5, 0.7), C({ -1.47418342167816818e+00, 6.47850703097326525e-17 }, { 6.71869507493797702e-01, -2.27652138489021882e-17 }) },
+      { C(0.8, -0.4), C({ 8.07591302647841625e-01, 4.95710010449123876e-17 }, { -4.11144088340916591e-01, -1.13902027847241327e-17 }) },
+      { C(2.0, 1.0), C({ 2.04211070125439553e+00, 1.36282786461655556e-16 }, { 1.08314493579095994e+00, -9.27209455151511209e-18 }) },
+      { C(-5.0, -3.0), C({ -4.77510935307200590e+00, -3.26842763167250549e-16 }, { -2.68182131351427921e+00, -8.72942186207172117e-17 }) },
+      { C(0.5, 0.0), C({ 5.04095397803988599e-01, -4.78495575170935650e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(1.5, 0.0), C({ 1.54224413523803072e+00, 8.93393962359831605e-17 }, { -2.86903643496748645e-04, 1.37448225586457970e-20 }) },
+      { C(-0.25, 1e-10), C({ -2.49043975030334486e-01, -7.71523214389962768e-18 }, { 9.92430580159131510e-11, 2.09956035032677515e-27 }) },
+      { C(1e-20, 1e-20), C({ 9.99999999999999945e-21, -2.74348422496570620e-63 }, { 9.99999999999999945e-21, 3.12499999999999978e-42 }) },
+      { C(0.999, 0.001), C({ 1.01630613423893412e+00, -1.21515811529955167e-17 }, { 1.03688236931222364e-03, -6.82372858488768853e-20 }) },
+      { C(-1.0, 0.0), C({ -9.85551091297435122e-01, 1.82085964819228207e-17 }, { 0.00000000000000000e+00, 0.00000000000000000e+00 }) },
+      { C(10.0, 0.5), C({ 1.11371547042978296e+01, -3.61557181664632457e-16 }, { 2.25309925185749371e+00, 7.03072078244341404e-18 }) }
+   }, eps);
+}
+
+TEST_CASE("test_Cl_fixed_values")
+{
+   using polylogarithm::Cl2;
+   using polylogarithm::Cl3;
+   using polylogarithm::Cl4;
+   using polylogarithm::Cl5;
+   using polylogarithm::Cl6;
+
+   const double eps = 1e-30;
+
+   // generated with mpmath: Im/Re(polylog(n, exp(1j*x)))
+   check_values([] (const DoubleDouble& x) { return Cl2(x); }, {
+      { 1e-08, { 1.94206807439523651e-07, 8.03105530012431138e-24 } },
+      { 0.5, { 8.48311877703679218e-01, 5.30278565836310627e-17 } },
+      { 1.0, { 1.01395913236076840e+00, 1.03934089818679690e-16 } },
+      { 2.0, { 7.27146050863279214e-01, 3.33028053534479395e-17 } },
+      { 3.0, { 9.80262093913014249e-02, -3.69441705539922881e-18 } },
+      { -2.0, { -7.27146050863279214e-01, -3.33028053534479395e-17 } },
+      { 10.0, { -3.90716476086802100e-01, -1.01462258449938769e-17 } }
+   }, eps);
+
+   check_values([] (const DoubleDouble& x) { return Cl3(x); }, {
+      { 1e-08, { 1.20205690315959335e+00, -5.90967073936977661e-17 } },
+      { 0.5, { 9.27696310470230379e-01, 5.26033534937740282e-17 } },
+      { 1.0, { 4.48573007280017422e-01, -2.39882412093932604e-17 } },
+      { 2.0, { -4.67971472084971030e-01, -1.80584997417346848e-18 } },
+      { 3.0, { -8.94598592123167280e-01, 1.28733850614864914e-17 } },
+      { -2.0, { -4.67971472084971030e-01, -1.80584997417346848e-18 } },
+      { 10.0, { -7.88015071542245926e-01, -1.87429046683778928e-17 } }
+   }, eps);
+
+   check_values([] (const DoubleDouble& x) { return Cl4(x); }, {
+      { 1e-08, { 1.20205690315959391e-08, 6.10746441963710544e-25 } },
+      { 0.5, { 5.48371726545895499e-01, -1.03841920048685659e-17 } },
+      { 1.0, { 8.95805238679380000e-01, -3.78020183859415297e-17 } },
+      { 2.0, { 8.61425916934444369e-01, -1.22213934091569102e-17 } },
+      { 3.0, { 1.27323997112122306e-01, -5.61749483919278033e-19 } },
+      { -2.0, { -8.61425916934444369e-01, 1.22213934091569102e-17 } },
+      { 10.0, { -4.96731191105191983e-01, -1.23610932166270810e-17 } }
+   }, eps);
+
+   check_values([] (const DoubleDouble& x) { return Cl5(x); }, {
+      { 1e-08, { 1.03692775514336977e+00, 9.91738695632739176e-17 } },
+      { 0.5, { 8.93902869510838527e-01, -1.89741141013086613e-17 } },
+      { 1.0, { 5.22820807642094265e-01, -2.20238271174301138e-17 } },
+      { 2.0, { -4.32933808287317701e-01, -2.43171134992637580e-18 } },
+      { 3.0, { -9.63094096209422990e-01, 3.14437719173933090e-17 } },
+      { -2.0, { -4.32933808287317701e-01, -2.43171134992637580e-18 } },
+      { 10.0, { -8.26117715811084841e-01, 3.75063109747448443e-17 } }
+   }, eps);
+
+   check_values([] (const DoubleDouble& x) { return Cl6(x); }, {
+      { 1e-08, { 1.03692775514336993e-08, 2.47469326302827001e-26 } },
+      { 0.5, { 4.94196279776188019e-01, -1.85714754026210537e-18 } },
+      { 1.0, { 8.55629273183937222e-01, -4.56069421879477453e-17 } },
+      { 2.0, { 8.97290982663682346e-01, -1.43548492085593520e-18 } },
+      { 3.0, { 1.37218809100637051e-01, -3.03612044028062213e-18 } },
+      { -2.0, { -8.97290982663682346e-01, 1.43548492085593520e-18 } },
+      { 10.0, { -5.30949055975031614e-01, 5.20076733894160555e-17 } }
+   }, eps);
+}
+
+TEST_CASE("test_consistency_with_double")
+{
+   using polylogarithm::bench::generate_random_complexes;
+   using polylogarithm::bench::generate_random_scalars;
+
+   const double eps = 1e-14;
+   const auto zs = generate_random_complexes<double>(1000, -5, 5);
+   const auto xs = generate_random_scalars<double>(1000, -10, 10);
+
+   for (const auto& z: zs) {
+      const C zdd(z.real(), z.imag());
+      INFO("z = " << z);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li2(zdd)), polylogarithm::Li2(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li3(zdd)), polylogarithm::Li3(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li4(zdd)), polylogarithm::Li4(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li5(zdd)), polylogarithm::Li5(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li6(zdd)), polylogarithm::Li6(z), eps);
+   }
+
+   // real axis, including the branch cut z > 1
+   for (const auto x: xs) {
+      const std::complex<double> z(x, 0.0);
+      const C zdd(x);
+      INFO("x = " << x);
+      CHECK_CLOSE(static_cast<double>(polylogarithm::Li2(DoubleDouble(x))), polylogarithm::Li2(x), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li2(zdd)), polylogarithm::Li2(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li3(zdd)), polylogarithm::Li3(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li4(zdd)), polylogarithm::Li4(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li5(zdd)), polylogarithm::Li5(z), eps);
+      CHECK_CLOSE_COMPLEX(to_complex(polylogarithm::Li6(zdd)), polylogarithm::Li6(z), eps);
+   }
+
+   for (const auto x: xs) {
+      const DoubleDouble xdd(x);
+      INFO("x = " << x);
+      CHECK_CLOSE(static_cast<double>(polylogarithm::Cl2(xdd)), polylogarithm::Cl2(x), eps);
+      CHECK_CLOSE(static_cast<double>(polylogarithm::Cl3(xdd)), polylogarithm::Cl3(x), eps);
+      CHECK_CLOSE(static_cast<double>(polylogarithm::Cl4(xdd)), polylogarithm::Cl4(x), eps);
+      CHECK_CLOSE(static_cast<double>(polylogarithm::Cl5(xdd)), polylogarithm::Cl5(x), eps);
+      CHECK_CLOSE(static_cast<double>(polylogarithm::Cl6(xdd)), polylogarithm::Cl6(x), eps);
+   }
+}
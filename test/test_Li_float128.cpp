@@ -0,0 +1,185 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Li2.hpp"
+#include "Li3.hpp"
+#include "Li4.hpp"
+#include "Li5.hpp"
+#include "Li6.hpp"
+#include "Li_float128.hpp"
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#ifdef ENABLE_FLOAT128
+
+#include <quadmath.h>
+
+#define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
+
+#define CHECK_CLOSE_COMPLEX(a,b,eps) do {                               \
+      CHECK_CLOSE(std::real(a), std::real(b), (eps));                   \
+      CHECK_CLOSE(std::imag(a), std::imag(b), (eps));                   \
+   } while (0)
+
+using C = std::complex<__float128>;
+
+namespace {
+
+/// relative difference of a and b, measured relative to max(|b|, 1)
+double rel_diff(__float128 a, __float128 b)
+{
+   return static_cast<double>(fabsq(a - b)/fmaxq(fabsq(b), 1));
+}
+
+template <typename Fn>
+void check_values(Fn f, const std::vector<std::pair<C, C>>& values, double eps)
+{
+   for (const auto& v: values) {
+      const C z = v.first;
+      const C li = f(z);
+      INFO("z = (" << static_cast<double>(z.real()) << ", " << static_cast<double>(z.imag()) << ")");
+      CHECK(rel_diff(li.real(), v.second.real()) <= eps);
+      CHECK(rel_diff(li.imag(), v.second.imag()) <= eps);
+   }
+}
+
+} // anonymous namespace
+
+TEST_CASE("test_real_Li2")
+{
+   // generated with mpmath: polylog(2, x)
+   const std::vector<std::pair<__float128, __float128>> values = {
+      { -10.0, -4.19827788685810385791214501909223721Q },
+      { -1.0, -8.22467033424113218236207583323012595e-1Q },
+      { -0.3, -2.80074333759582894520788730617011962e-1Q },
+      { 0.25, 2.67652639082732606919183828487811576e-1Q },
+      { 0.7, 8.89377624286038662219387509940369068e-1Q },
+      { 1.0, 1.64493406684822643647241516664602519Q },
+      { 1.5, 2.37439527027248020067749976307163842Q },
+      { 3.0, 2.32018042331309839640619447370310466Q },
+      { 100.0, -7.32395319900048224272397049830885578Q }
+   };
+
+   for (const auto& v: values) {
+      INFO("x = " << static_cast<double>(v.first));
+      CHECK(rel_diff(polylogarithm::Li2(v.first), v.second) <= 1e-32);
+   }
+}
+
+TEST_CASE("test_complex_fixed_values")
+{
+   using polylogarithm::Li2;
+   using polylogarithm::Li3;
+   using polylogarithm::Li4;
+   using polylogarithm::Li5;
+   using polylogarithm::Li6;
+
+   const double eps = 1e-32;
+
+   // generated with mpmath: polylog(n, z), with Im = -pi*log(z)^(n-1)/(n-1)! for z > 1
+   check_values([] (const C& z) { return Li2(z); }, {
+      { C(0.3, 0.2), C(3.10452975621157057915047179566592809e-1Q, 2.35867921016975215465360426562330860e-1Q) },
+      { C(-1.5, 0.7), C(-1.18108583027324636619691750905798689Q, 4.23120824905467474805357239336276108e-1Q) },
+      { C(0.8, -0.4), C(8.81587791658611460932257174770746459e-1Q, -6.85071842886017514695688554557684586e-1Q) },
+      { C(2.0, 1.0), C(1.18668853700005783111280010040687718Q, 2.40774076934577200171390527552484799Q) },
+      { C(-5.0, -3.0), C(-2.90971403539970290412352651942080274Q, -1.03512179391099762496807965788016093Q) },
+      { C(0.5, 0.0), C(5.82240526465012505902656320159680109e-1Q, 0.0Q) },
+      { C(1.5, 0.0), C(2.37439527027248020067749976307163842Q, -1.27380620491960053093313168558047170Q) },
+      { C(-0.25, 1e-10), C(-2.35900297686263453822934278054168865e-1Q, 8.92574205256839055582949301599714101e-11Q) },
+      { C(0.999, 0.001), C(1.63658670567752521288525934178974672Q, 6.78284982771614987594577298917145254e-3Q) },
+      { C(-1.0, 0.0), C(-8.22467033424113218236207583323012595e-1Q, 0.0Q) },
+      { C(10.0, 0.5), C(3.77994736474730693955214166954091611e-1Q, 7.12786483133358660745521422154000130Q) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li3(z); }, {
+      { C(0.3, 0.2), C(3.05672369527297674628832131638953888e-1Q, 2.16894533836273012466938698157858332e-1Q) },
+      { C(-1.5, 0.7), C(-1.32268275931416138403474870105616987Q, 5.33022294854851443139958139004455462e-1Q) },
+      { C(0.8, -0.4), C(8.54711944026355718886579712347998755e-1Q, -5.18339888089547981563585223741635479e-1Q) },
+      { C(2.0, 1.0), C(1.89018684728998863588671180797977309Q, 1.84738717203210791464932783082987990Q) },
+      { C(-5.0, -3.0), C(-3.70173371786478970027117334679808783Q, -1.61751134499409085269220187678672452Q) },
+      { C(0.5, 0.0), C(5.37213193608040200940623225594965827e-1Q, 0.0Q) },
+      { C(1.5, 0.0), C(2.06087750732028087129056420663776066Q, -2.58241985293288210753273250419499596e-1Q) },
+      { C(-0.25, 1e-10), C(-2.42712003338916305151771437615145053e-1Q, 9.43601190745053849661543150406027926e-11Q) },
+      { C(0.999, 0.001), C(1.20041274863286622779425340722680250Q, 1.63851040117247120345625148112283898e-3Q) },
+      { C(-1.0, 0.0), C(-9.01542677369695714049803621133587493e-1Q, 0.0Q) },
+      { C(10.0, 0.5), C(5.28363876140045366403183221851631495Q, 8.35999376787280303222791232093086846Q) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li4(z); }, {
+      { C(0.3, 0.2), C(3.02956109495369814126099099810628288e-1Q, 2.08115732468590872137396468983864788e-1Q) },
+      { C(-1.5, 0.7), C(-1.40473099146723975404795943174469830Q, 6.04490853359693799863543915617732171e-1Q) },
+      { C(0.8, -0.4), C(8.29614491774393303089933308818019874e-1Q, -4.51727484762487994053581753506848536e-1Q) },
+      { C(2.0, 1.0), C(2.06459015126838940357495412320603923Q, 1.41295054410386083208332701194486607Q) },
+      { C(-5.0, -3.0), C(-4.24382278783901953303898136001927843Q, -2.10138662475925088277445674531630095Q) },
+      { C(0.5, 0.0), C(5.17479061673899386330758161898862946e-1Q, 0.0Q) },
+      { C(1.5, 0.0), C(1.73475708077606207377688051175145518Q, -3.49027048283367002627421237286554094e-2Q) },
+      { C(-0.25, 1e-10), C(-2.46272788760729064368894425261837583e-1Q, 9.70848013355665255973037533294558162e-11Q) },
+      { C(0.999, 0.001), C(1.08112117850712740070625428375798387Q, 1.20161624318292887699682813272144089e-3Q) },
+      { C(-1.0, 0.0), C(-9.47032829497245917576503234473521915e-1Q, 0.0Q) },
+      { C(10.0, 0.5), C(9.20395451923992217478710806674062347Q, 6.67543703561083314588310186302755686Q) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li5(z); }, {
+      { C(0.3, 0.2), C(3.01511644615002125690896625163005812e-1Q, 2.03951253798444749047136115262105167e-1Q) },
+      { C(-1.5, 0.7), C(-1.45000649619456184719534297906757695Q, 6.47436194849887140563573607501730864e-1Q) },
+      { C(0.8, -0.4), C(8.15127125018262865083869564858492912e-1Q, -4.23634508381809778517697497487367853e-1Q) },
+      { C(2.0, 1.0), C(2.06736901563944184989254088887215499Q, 1.18616983515580603345099744308372343Q) },
+      { C(-5.0, -3.0), C(-4.58030011306448988157910423299589929Q, -2.45178734174642166288503320517629425Q) },
+      { C(0.5, 0.0), C(5.08400579242268707459108849258589941e-1Q, 0.0Q) },
+      { C(1.5, 0.0), C(1.59617394568135341026890691433383979Q, -3.53795724662222278237860427614620620e-3Q) },
+      { C(-0.25, 1e-10), C(-2.48107645039782873815167994687731902e-1Q, 9.85091155042916293362400237226567547e-11Q) },
+      { C(0.999, 0.001), C(1.03584543197654250006421584031158561Q, 1.08220356771584246974277426333039170e-3Q) },
+      { C(-1.0, 0.0), C(-9.72119770446909305935655143553469533e-1Q, 0.0Q) },
+      { C(10.0, 0.5), C(1.09242958048799408381149856843379316e+1Q, 4.15783200870485485780862496994166841Q) }
+   }, eps);
+
+   check_values([] (const C& z) { return Li6(z); }, {
+      { C(0.3, 0.2), C(3.00765569708624954868880287269432156e-1Q, 2.01941083323744625729869190309089119e-1Q) },
+      { C(-1.5, 0.7), C(-1.47418342167816811732671966470956394Q, 6.71869507493797679103984286780192666e-1Q) },
+      { C(0.8, -0.4), C(8.07591302647841674133375863109374109e-1Q, -4.11144088340916602785515946862468662e-1Q) },
+      { C(2.0, 1.0), C(2.04211070125439566908267659555705753Q, 1.08314493579095993030896281813569590Q) },
+      { C(-5.0, -3.0), C(-4.77510935307200622900601825388484739Q, -2.68182131351427930202340431705924376Q) },
+      { C(0.5, 0.0), C(5.04095397803988550690046509788879095e-1Q, 0.0Q) },
+      { C(1.5, 0.0), C(1.54224413523803081157412178067796772Q, -2.86903643496748630940545387393126697e-4Q) },
+      { C(-0.25, 1e-10), C(-2.49043975030334493402665387483282793e-1Q, 9.92430580159131531415947626812786105e-11Q) },
+      { C(0.999, 0.001), C(1.01630613423893411024193503764557780Q, 1.03688236931222356751438271121302209e-3Q) },
+      { C(-1.0, 0.0), C(-9.85551091297435104098439244484954261e-1Q, 0.0Q) },
+      { C(10.0, 0.5), C(1.11371547042978292489248584877869021e+1Q, 2.25309925185749371926736717063514421Q) }
+   }, eps);
+}
+
+TEST_CASE("test_consistency_with_long_double")
+{
+   using CL = std::complex<long double>;
+
+   const auto eps = 100*std::numeric_limits<long double>::epsilon();
+   const auto zs = polylogarithm::bench::generate_random_complexes<double>(1000, -5, 5);
+
+   const auto to_cl = [] (const C& z) {
+      return CL(static_cast<long double>(z.real()), static_cast<long double>(z.imag()));
+   };
+
+   for (const auto& z: zs) {
+      const C zq(z.real(), z.imag());
+      const CL zl(z.real(), z.imag());
+      INFO("z = " << z);
+      CHECK_CLOSE_COMPLEX(to_cl(polylogarithm::Li2(zq)), polylogarithm::Li2(zl), eps);
+      CHECK_CLOSE_COMPLEX(to_cl(polylogarithm::Li3(zq)), polylogarithm::Li3(zl), eps);
+      CHECK_CLOSE_COMPLEX(to_cl(polylogarithm::Li4(zq)), polylogarithm::Li4(zl), eps);
+      CHECK_CLOSE_COMPLEX(to_cl(polylogarithm::Li5(zq)), polylogarithm::Li5(zl), eps);
+      CHECK_CLOSE_COMPLEX(to_cl(polylogarithm::Li6(zq)), polylogarithm::Li6(zl), eps);
+   }
+}
+
+#else
+
+TEST_CASE("test_no_float128")
+{
+   MESSAGE("__float128 is not supported, skipping tests");
+}
+
+#endif
@@ -0,0 +1,132 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Li.hpp"
+#include "Li_jet.hpp"
+#include <array>
+#include <cmath>
+#include <complex>
+#include <vector>
+
+#define CHECK_CLOSE(a,b,eps) CHECK((a) == doctest::Approx(b).epsilon(eps))
+
+#define CHECK_CLOSE_COMPLEX(a,b,eps) do {                               \
+      CHECK_CLOSE(std::real(a), std::real(b), (eps));                   \
+      CHECK_CLOSE(std::imag(a), std::imag(b), (eps));                   \
+   } while (0)
+
+namespace {
+
+template <std::size_t M>
+void check_jet(const std::array<std::complex<double>, M>& jet,
+               const std::vector<std::complex<double>>& expected, double eps)
+{
+   REQUIRE(jet.size() == expected.size());
+
+   for (std::size_t k = 0; k < jet.size(); ++k) {
+      INFO("k = " << k);
+      CHECK_CLOSE_COMPLEX(jet[k], expected[k], eps);
+   }
+}
+
+} // anonymous namespace
+
+TEST_CASE("test_fixed_values")
+{
+   using polylogarithm::Li_jet;
+   using C = std::complex<double>;
+
+   const double eps = 1e-14;
+
+   // generated with mpmath: [diff(lambda t: polylog(N, t), z, k) for k in range(Order + 1)]
+   check_jet(Li_jet<2, 3>(C(0.3, 0.2)), {
+      C(0.31045297562115703, 0.2358679210169752), C(1.1607051743570593, 0.15386208044566502),
+      C(0.7131857293176646, 0.2695308808561327), C(1.1094883864448268, 0.7861219127157267)
+   }, eps);
+
+   check_jet(Li_jet<2, 3>(C(-1.5, 0.7)), {
+      C(-1.1810858302732463, 0.4231208249054675), C(0.5920259254941092, 0.09427296317277721),
+      C(0.1234920762035284, 0.05123989983311231), C(0.05929912169948108, 0.04462900812073318)
+   }, eps);
+
+   check_jet(Li_jet<3, 2>(C(0.8, -0.4)), {
+      C(0.8547119440263558, -0.518339888089548), C(1.22412371310162, -0.24427794705671177),
+      C(0.3644252483269021, -0.39342649162261606)
+   }, eps);
+
+   check_jet(Li_jet<4, 4>(C(2.0, 1.0)), {
+      C(2.0645901512683893, 1.4129505441038608), C(1.125552173322417, 0.36091749935484546),
+      C(0.005236778335394558, 0.17980216132402863), C(-0.10517855379990916, -0.007644690990877223),
+      C(0.04205526910780611, -0.10776171869563263)
+   }, eps);
+
+   check_jet(Li_jet<6, 4>(C(-0.2, 0.9)), {
+      C(-0.21129974799498588, 0.8936665966834898), C(0.991124065246005, 0.02622365461313307),
+      C(0.02806718080766327, 0.005922053741481736), C(0.005515963873215855, 0.0032569337403139244),
+      C(0.002115330827180861, 0.00294048169431854)
+   }, eps);
+
+   check_jet(Li_jet<8, 2>(C(0.6, 0.6)), {
+      C(0.5999255076463624, 0.6028772923291406), C(1.0046535594499564, 0.005041441999048543),
+      C(0.008328210571479092, 0.0006989158933818467)
+   }, eps);
+
+   check_jet(Li_jet<1, 2>(C(-3.0, 0.5)), {
+      C(-1.3940464543878732, 0.12435499454676144), C(0.24615384615384617, 0.03076923076923077),
+      C(0.059644970414201186, 0.01514792899408284)
+   }, eps);
+}
+
+TEST_CASE("test_zero")
+{
+   const auto jet = polylogarithm::Li_jet<3, 4>(std::complex<double>(0.0, 0.0));
+
+   // d^k/dz^k Li_3(0) = k!/k^3
+   CHECK(jet[0] == 0.0);
+   CHECK_CLOSE(std::real(jet[1]), 1.0, 1e-15);
+   CHECK_CLOSE(std::real(jet[2]), 2.0/8, 1e-15);
+   CHECK_CLOSE(std::real(jet[3]), 6.0/27, 1e-15);
+   CHECK_CLOSE(std::real(jet[4]), 24.0/64, 1e-15);
+}
+
+TEST_CASE("test_random_values")
+{
+   using namespace polylogarithm;
+   using polylogarithm::bench::generate_random_complexes;
+
+   const auto values = generate_random_complexes<double>(10000, -5, 5);
+
+   for (const auto& z: values) {
+      INFO("z = " << z);
+
+      const auto jet2 = Li_jet<2, 2>(z);
+      const auto jet5 = Li_jet<5, 3>(z);
+      const auto jetn = Li_jet<-2, 1>(z);
+
+      CHECK_CLOSE_COMPLEX(jet2[0], Li2(z), 1e-15);
+      CHECK_CLOSE_COMPLEX(jet5[0], Li5(z), 1e-15);
+      CHECK_CLOSE_COMPLEX(jetn[0], Li(-2, z), 1e-14);
+
+      // d/dz Li_n(z) = Li_{n-1}(z)/z
+      CHECK_CLOSE_COMPLEX(jet2[1], Li(1, z)/z, 1e-13);
+      CHECK_CLOSE_COMPLEX(jet5[1], Li4(z)/z, 1e-13);
+      CHECK_CLOSE_COMPLEX(jetn[1], Li(-3, z)/z, 1e-12);
+
+      // d^2/dz^2 Li_n(z) = (Li_{n-2}(z) - Li_{n-1}(z))/z^2
+      CHECK_CLOSE_COMPLEX(jet2[2], (Li(0, z) - Li(1, z))/(z*z), 1e-12);
+      CHECK_CLOSE_COMPLEX(jet5[2], (Li3(z) - Li4(z))/(z*z), 1e-12);
+   }
+}
+
+TEST_CASE("test_dual")
+{
+   using namespace polylogarithm;
+
+   const std::complex<double> z(0.7, -1.3), dz(2.0, 0.5);
+
+   const auto li = Li<3>(Dual<std::complex<double>>{z, dz});
+
+   CHECK_CLOSE_COMPLEX(li.val, Li3(z), 1e-15);
+   CHECK_CLOSE_COMPLEX(li.der, dz*Li2(z)/z, 1e-14);
+}
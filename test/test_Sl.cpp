@@ -7,6 +7,10 @@
 #include <cmath>
 #include <complex>
 
+#ifndef M_PI
+#define M_PI 3.1415926535897932
+#endif
+
 #define CHECK_CLOSE(a,b,eps) do {                       \
       if (std::isinf(a) && std::isinf(b))               \
          CHECK(true);                                   \
@@ -47,3 +51,33 @@ TEST_CASE("test_fixed_values")
       }
    }
 }
+
+TEST_CASE("test_grid")
+{
+   struct Grid { double x0; double h; std::size_t count; };
+
+   const Grid grids[] = {
+      {  0.0     , 0.001 , 10000 },
+      { -20.0    , 0.004 , 10000 },
+      {  M_PI    , -0.03 , 1000  },
+      {  1.0     , 2*M_PI, 10    },
+      {  0.5     , 0.0   , 100   }
+   };
+
+   for (int64_t n = 1; n <= 40; ++n) {
+      for (const auto& g: grids) {
+         const auto values = polylogarithm::Sl_grid(n, g.x0, g.h, g.count);
+
+         REQUIRE(values.size() == g.count);
+
+         for (std::size_t k = 0; k < g.count; ++k) {
+            const double x = g.x0 + k*g.h;
+            INFO("n = " << n << ", x = " << x);
+            CHECK_CLOSE(values[k], polylogarithm::Sl(n, x), 1e-13);
+         }
+      }
+   }
+
+   polylogarithm::Sl_grid(3, 0.0, 0.1, 0, nullptr);
+   CHECK(std::isnan(polylogarithm::Sl_grid(0, 1.0, 0.1, 1)[0]));
+}
@@ -0,0 +1,185 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "Li.hpp"
+#include "Li2.hpp"
+#include "Li3.hpp"
+#include "Li4.hpp"
+#include "Li5.hpp"
+#include "Li6.hpp"
+#include "branch_counter.hpp"
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifndef POLYLOGARITHM_BRANCH_COUNTERS
+#error "test_branch_counter must be compiled with POLYLOGARITHM_BRANCH_COUNTERS"
+#endif
+
+using polylogarithm::Branch;
+using polylogarithm::branch_count;
+using polylogarithm::thread_branch_count;
+
+TEST_CASE("test_names")
+{
+   using polylogarithm::branch_name;
+
+   CHECK(polylogarithm::branch_counters_enabled());
+
+   for (std::size_t i = 0; i < static_cast<std::size_t>(Branch::NUMBER_OF_BRANCHES); ++i) {
+      CHECK(std::strchr(branch_name(static_cast<Branch>(i)), ':') != nullptr);
+   }
+
+   CHECK(std::string(branch_name(Branch::Li2_x_lt_m1)) == "Li2(x): x < -1");
+   CHECK(std::string(branch_name(Branch::NUMBER_OF_BRANCHES)).empty());
+}
+
+TEST_CASE("test_real")
+{
+   using polylogarithm::Li2;
+   using polylogarithm::Li3;
+   using polylogarithm::Li4;
+
+   polylogarithm::reset_branch_counts();
+
+   for (double x: {-2.0, -1.0, -0.5, 0.0, 0.25, 0.75, 1.0, 1.5, 3.0}) {
+      Li2(x);
+   }
+   Li2(-3.0);
+
+   CHECK(branch_count(Branch::Li2_x_lt_m1) == 2);
+   CHECK(branch_count(Branch::Li2_x_eq_m1) == 1);
+   CHECK(branch_count(Branch::Li2_x_lt_0) == 1);
+   CHECK(branch_count(Branch::Li2_x_eq_0) == 1);
+   CHECK(branch_count(Branch::Li2_x_lt_half) == 1);
+   CHECK(branch_count(Branch::Li2_x_lt_1) == 1);
+   CHECK(branch_count(Branch::Li2_x_eq_1) == 1);
+   CHECK(branch_count(Branch::Li2_x_lt_2) == 1);
+   CHECK(branch_count(Branch::Li2_x_ge_2) == 1);
+
+   Li3(0.5);
+   Li3(1.5);
+   CHECK(branch_count(Branch::Li3_x_eq_half) == 1);
+   CHECK(branch_count(Branch::Li3_x_lt_2) == 1);
+
+   // transformation to [-1,1] and approximation on [0.8,1]
+   Li4(1.1);
+   CHECK(branch_count(Branch::Li4_x_gt_1) == 1);
+   CHECK(branch_count(Branch::Li4_approx_one) == 1);
+   CHECK(branch_count(Branch::Li4_approx_half) == 0);
+}
+
+TEST_CASE("test_complex")
+{
+   using polylogarithm::Li2;
+   using polylogarithm::Li3;
+   using polylogarithm::Li5;
+   using polylogarithm::Li6;
+
+   polylogarithm::reset_branch_counts();
+
+   Li2(std::complex<double>(-2.0, 1.0));
+   Li2(std::complex<double>(0.0, 0.5));
+   Li2(std::complex<double>(0.9, 0.1));
+   Li2(std::complex<double>(2.0, 2.0));
+   Li2(std::complex<double>(1e-9, 1e-9));
+
+   CHECK(branch_count(Branch::Li2_z_re_le_half_abs_gt_1) == 1);
+   CHECK(branch_count(Branch::Li2_z_re_le_half_abs_le_1) == 1);
+   CHECK(branch_count(Branch::Li2_z_re_gt_half_near_1) == 1);
+   CHECK(branch_count(Branch::Li2_z_re_gt_half_far_1) == 1);
+   CHECK(branch_count(Branch::Li2_z_small) == 1);
+
+   // the real axis is forwarded to Li2(double), both count their branch
+   Li2(std::complex<double>(0.25, 0.0));
+   CHECK(branch_count(Branch::Li2_z_real) == 1);
+   CHECK(branch_count(Branch::Li2_x_lt_half) == 1);
+
+   Li3(std::complex<double>(1.0, 0.5));
+   Li5(std::complex<double>(-1.0, 0.0));
+   Li6(std::complex<double>(-3.0, 2.0));
+
+   CHECK(branch_count(Branch::Li3_z_log_lt_1) == 1);
+   CHECK(branch_count(Branch::Li5_z_special) == 1);
+   CHECK(branch_count(Branch::Li6_z_abs_gt_1) == 1);
+}
+
+TEST_CASE("test_Li")
+{
+   using polylogarithm::Li;
+
+   polylogarithm::reset_branch_counts();
+
+   Li(7, std::complex<double>(0.5, 0.1));
+   Li(7, std::complex<double>(1.0, 0.3));
+   Li(7, std::complex<double>(2.0, 1.0));
+   Li(3, std::complex<double>(3.0, 1.0));
+   Li(0, std::complex<double>(2.0, 1.0));
+   Li(-3, std::complex<double>(1.0, 0.0));
+   Li(-3, std::complex<double>(0.9, 0.1));
+
+   CHECK(branch_count(Branch::Li_series) == 1);
+   CHECK(branch_count(Branch::Li_unity_pos) == 1);
+   CHECK(branch_count(Branch::Li_inversion) == 1);
+   // Li(3,z) is counted by Li(n,z) and by Li3(z)
+   CHECK(branch_count(Branch::Li_dedicated) == 1);
+   CHECK(branch_count(Branch::Li3_z_abs_gt_1) == 1);
+   CHECK(branch_count(Branch::Li_closed_form) == 1);
+   CHECK(branch_count(Branch::Li_special) == 1);
+   CHECK(branch_count(Branch::Li_neg_unity) == 1);
+}
+
+TEST_CASE("test_threads")
+{
+   using polylogarithm::Li2;
+
+   polylogarithm::reset_branch_counts();
+
+   Li2(0.25);
+
+   uint64_t worker_count = 0;
+
+   std::thread worker([&worker_count] {
+      for (int i = 0; i < 10; ++i) {
+         Li2(0.25);
+      }
+      worker_count = thread_branch_count(Branch::Li2_x_lt_half);
+   });
+   worker.join();
+
+   // the counts of the finished thread are kept in the total
+   CHECK(worker_count == 10);
+   CHECK(thread_branch_count(Branch::Li2_x_lt_half) == 1);
+   CHECK(branch_count(Branch::Li2_x_lt_half) == 11);
+
+   polylogarithm::reset_branch_counts();
+
+   CHECK(thread_branch_count(Branch::Li2_x_lt_half) == 0);
+   CHECK(branch_count(Branch::Li2_x_lt_half) == 0);
+}
+
+TEST_CASE("test_print")
+{
+   using polylogarithm::Li2;
+
+   polylogarithm::reset_branch_counts();
+
+   Li2(0.25);
+   Li2(0.25);
+   Li2(3.0);
+   Li2(3.0);
+
+   std::ostringstream ostr;
+   polylogarithm::print_branch_counts(ostr);
+   const std::string out = ostr.str();
+
+   INFO(out);
+   CHECK(out.find("Li2(x): 4 calls") != std::string::npos);
+   CHECK(out.find("0 < x < 1/2") != std::string::npos);
+   CHECK(out.find("x >= 2") != std::string::npos);
+   CHECK(out.find("50.00 %") != std::string::npos);
+   CHECK(out.find("Li3") == std::string::npos);
+}
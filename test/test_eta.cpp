@@ -15,3 +15,18 @@ TEST_CASE("test_fixed_values")
    CHECK(neg_eta(55) == -1.0);
    CHECK(neg_eta(56) == -1.0);
 }
+
+TEST_CASE("test_constexpr")
+{
+   using polylogarithm::neg_eta;
+
+   static_assert(neg_eta(0) == -0.5, "neg_eta(0) must be a constant expression");
+   static_assert(neg_eta(1) == -0.69314718055994531, "neg_eta(1) must be a constant expression");
+   static_assert(neg_eta(-2) == 0.0, "neg_eta(-2) must be a constant expression");
+   static_assert(neg_eta(100) == -1.0, "neg_eta(100) must be a constant expression");
+
+   constexpr double e[] = { neg_eta(2), neg_eta(-1) };
+
+   CHECK(e[0] == neg_eta(2));
+   CHECK(e[1] == neg_eta(-1));
+}
@@ -13,3 +13,17 @@ TEST_CASE("test_fixed_values")
    CHECK(inv_fac(177) == 2.8547896502574379e-323);
    CHECK(inv_fac(178) == 0.0);
 }
+
+TEST_CASE("test_constexpr")
+{
+   using polylogarithm::inv_fac;
+
+   static_assert(inv_fac(0) == 1.0, "inv_fac(0) must be a constant expression");
+   static_assert(inv_fac(3) == inv_fac(2)/3, "inv_fac(3) must be a constant expression");
+   static_assert(inv_fac(200) == 0.0, "inv_fac(200) must be a constant expression");
+
+   constexpr double f[] = { inv_fac(4), inv_fac(10) };
+
+   CHECK(f[0] == inv_fac(4));
+   CHECK(f[1] == inv_fac(10));
+}
@@ -17,3 +17,17 @@ TEST_CASE("test_fixed_values")
    CHECK_CLOSE(harmonic(20), 3.5977396571436819, eps);
    CHECK_CLOSE(harmonic(100), 5.1873775176396203, eps);
 }
+
+TEST_CASE("test_constexpr")
+{
+   using polylogarithm::harmonic;
+
+   static_assert(harmonic(1) == 1.0, "harmonic(1) must be a constant expression");
+   static_assert(harmonic(2) == 1.5, "harmonic(2) must be a constant expression");
+   static_assert(harmonic(19) > harmonic(18), "harmonic(19) must be a constant expression");
+
+   constexpr double h[] = { harmonic(3), harmonic(10) };
+
+   CHECK(h[0] == harmonic(3));
+   CHECK(h[1] == harmonic(10));
+}
@@ -0,0 +1,96 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "Cl.hpp"
+#include "Cl2Table.hpp"
+#include "Cl_all.hpp"
+#include "Li.hpp"
+#include "LiPlan.hpp"
+#include "Li_all.hpp"
+#include "Li_dd.hpp"
+#include "Li_float128.hpp"
+#include "Sl.hpp"
+#include "branch_counter.hpp"
+#include "inv_pow.hpp"
+#include "parallel.hpp"
+#include <complex>
+#include <vector>
+
+#ifndef POLYLOGARITHM_HEADER_ONLY
+#error "test_header_only must be compiled with POLYLOGARITHM_HEADER_ONLY"
+#endif
+
+namespace polylogarithm {
+namespace test {
+
+// defined in header_only_tu.cpp
+std::vector<double> header_only_values(double x);
+const std::vector<double>* header_only_inv_pow(int64_t n);
+
+} // namespace test
+} // namespace polylogarithm
+
+TEST_CASE("test_fixed_values")
+{
+   using namespace polylogarithm;
+
+   const double PI = 3.1415926535897932;
+   const double catalan = 0.91596559417721901505;
+
+   CHECK(Li2(1.0) == doctest::Approx(PI*PI/6).epsilon(1e-15));
+   CHECK(Li3(1.0) == doctest::Approx(1.2020569031595943).epsilon(1e-15));
+   CHECK(std::real(Li(8, std::complex<double>(1.0, 0.0))) == doctest::Approx(1.0040773561979443).epsilon(1e-15));
+   CHECK(Cl2(PI/2) == doctest::Approx(catalan).epsilon(1e-15));
+   CHECK(Cl2Table()(PI/2) == doctest::Approx(catalan).epsilon(1e-14));
+}
+
+TEST_CASE("test_translation_units")
+{
+   using namespace polylogarithm;
+
+   for (const double x: {-3.0, -0.5, 0.1, 0.7, 0.99, 2.5}) {
+      const std::complex<double> z(x, 0.5);
+      const Cl2Table table(64);
+      const LiPlan plan(8);
+
+      const std::vector<double> expected = {
+         Li2(x), Li3(x), Li4(x), Li2_fast(x), Li3_fast(x),
+         std::real(Li2(z)), std::imag(Li3(z)), std::real(Li4(z)),
+         std::imag(Li5(z)), std::real(Li6(z)), std::imag(Li(7, z)),
+         std::real(Li_all(z)[4]), std::imag(plan(z)),
+         Cl1(x), Cl2(x), Cl3(x), Cl4(x), Cl5(x), Cl6(x), Cl2_fast(x),
+         Cl(12, x), Sl(12, x), Cl_all(x)[5], table(x)
+      };
+
+      const auto values = test::header_only_values(x);
+
+      REQUIRE(values.size() == expected.size());
+
+      for (std::size_t i = 0; i < values.size(); ++i) {
+         INFO("x = " << x << ", i = " << i);
+         CHECK(values[i] == expected[i]);
+      }
+   }
+}
+
+TEST_CASE("test_shared_cache")
+{
+   // the cache of inv_pow() is shared between the translation units
+   const auto t = polylogarithm::inv_pow(13);
+   CHECK(polylogarithm::test::header_only_inv_pow(13) == t.get());
+}
+
+TEST_CASE("test_parallel")
+{
+   using namespace polylogarithm;
+
+   const std::vector<double> x = {-3.0, -0.5, 0.1, 0.7, 0.99, 2.5};
+   std::vector<double> out;
+   parallel::ThreadPool pool(2);
+
+   parallel::evaluate([](double x) { return Li2(x); }, x, out, pool);
+
+   for (std::size_t i = 0; i < x.size(); ++i) {
+      CHECK(out[i] == Li2(x[i]));
+   }
+}
@@ -0,0 +1,84 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "inv_pow.hpp"
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <vector>
+
+TEST_CASE("test_values")
+{
+   using polylogarithm::inv_pow;
+
+   const auto eps = std::numeric_limits<double>::epsilon();
+
+   for (int64_t n = 10; n <= 100; ++n) {
+      const auto t = inv_pow(n);
+      const auto kmax = static_cast<std::size_t>(std::ceil(std::pow(eps, -1.0/n)));
+
+      REQUIRE(t->size() == kmax);
+
+      for (std::size_t k = 1; k <= kmax; ++k) {
+         CHECK((*t)[k - 1] == std::pow(k, -n));
+      }
+   }
+}
+
+TEST_CASE("test_caching")
+{
+   using polylogarithm::inv_pow;
+
+   const auto t1 = inv_pow(10);
+   const auto t2 = inv_pow(11);
+   const auto t3 = inv_pow(10);
+
+   CHECK(t1 == t3);
+   CHECK(t1 != t2);
+}
+
+TEST_CASE("test_budget")
+{
+   using polylogarithm::inv_pow;
+
+   // hold a table, which is evicted from the cache below
+   const auto t = inv_pow(10);
+   const auto t_copy = *t;
+
+   for (int64_t n = 10; n <= 100000; ++n) {
+      inv_pow(n);
+      CHECK(polylogarithm::inv_pow_cache_size() <= polylogarithm::INV_POW_CACHE_BUDGET);
+   }
+
+   CHECK(*t == t_copy);
+}
+
+TEST_CASE("test_threads")
+{
+   using polylogarithm::inv_pow;
+
+   const int n_threads = 8;
+   std::vector<std::thread> threads;
+   std::vector<int> failures(n_threads, 0);
+
+   for (int i = 0; i < n_threads; ++i) {
+      threads.emplace_back([i, &failures] {
+         for (int64_t n = 1; n <= 2000; ++n) {
+            const int64_t m = 10 + (n*(i + 1)) % 500;
+            const auto t = inv_pow(m);
+            if (t->empty() || (*t)[0] != 1 || (t->size() > 1 && (*t)[1] != std::pow(2.0, -m))) {
+               failures[i]++;
+            }
+         }
+      });
+   }
+
+   for (auto& t: threads) {
+      t.join();
+   }
+
+   for (const auto f: failures) {
+      CHECK(f == 0);
+   }
+}
@@ -0,0 +1,135 @@
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN 1
+
+#include "doctest.h"
+#include "bench.hpp"
+#include "Cl.hpp"
+#include "Li.hpp"
+#include "Sl.hpp"
+#include "parallel.hpp"
+#include <atomic>
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+TEST_CASE("test_run_all_tasks")
+{
+   using polylogarithm::parallel::ThreadPool;
+
+   for (std::size_t n_threads: {1, 2, 3, 8}) {
+      ThreadPool pool(n_threads);
+      CHECK(pool.size() == n_threads);
+
+      for (std::size_t n_tasks: {0, 1, 5, 1000}) {
+         std::vector<std::atomic<int>> count(n_tasks);
+         for (auto& c: count) {
+            c = 0;
+         }
+
+         pool.run(n_tasks, [&](std::size_t i) { count[i]++; });
+
+         for (const auto& c: count) {
+            CHECK(c == 1);
+         }
+      }
+   }
+}
+
+TEST_CASE("test_exception")
+{
+   using polylogarithm::parallel::ThreadPool;
+
+   ThreadPool pool(4);
+   std::atomic<int> count(0);
+
+   CHECK_THROWS_AS(pool.run(100, [&](std::size_t i) {
+      count++;
+      if (i == 42) {
+         throw std::runtime_error("task failed");
+      }
+   }), std::runtime_error);
+
+   CHECK(count == 100);
+
+   // pool is still usable
+   count = 0;
+   pool.run(10, [&](std::size_t) { count++; });
+   CHECK(count == 10);
+}
+
+TEST_CASE("test_evaluate")
+{
+   using namespace polylogarithm;
+   using bench::generate_random_complexes;
+   using bench::generate_random_scalars;
+   using parallel::evaluate;
+
+   const auto x = generate_random_scalars<double>(10000, -10, 10);
+   const auto z = generate_random_complexes<double>(10000, -5, 5);
+   const std::size_t n = x.size();
+   parallel::ThreadPool pool(4);
+
+   SUBCASE("real") {
+      std::vector<double> out;
+
+      evaluate([](double x) { return Li2(x); }, x, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li2(x[i])); }
+
+      evaluate([](double x) { return Li3(x); }, x, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li3(x[i])); }
+
+      evaluate([](double x) { return Li4(x); }, x, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li4(x[i])); }
+   }
+
+   SUBCASE("complex") {
+      std::vector<std::complex<double>> out;
+
+      evaluate([](const std::complex<double>& z) { return Li2(z); }, z, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li2(z[i])); }
+
+      evaluate([](const std::complex<double>& z) { return Li3(z); }, z, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li3(z[i])); }
+
+      evaluate([](const std::complex<double>& z) { return Li4(z); }, z, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li4(z[i])); }
+
+      evaluate([](const std::complex<double>& z) { return Li5(z); }, z, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li5(z[i])); }
+
+      evaluate([](const std::complex<double>& z) { return Li6(z); }, z, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li6(z[i])); }
+
+      for (int64_t k: {-5, 0, 7, 20}) {
+         evaluate([k](const std::complex<double>& z) { return Li(k, z); }, z, out, pool);
+         for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Li(k, z[i])); }
+      }
+   }
+
+   SUBCASE("Clausen") {
+      std::vector<double> out;
+
+      for (int64_t k = 1; k <= 12; ++k) {
+         evaluate([k](double x) { return Cl(k, x); }, x, out, pool);
+         for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Cl(k, x[i])); }
+
+         evaluate([k](double x) { return Sl(k, x); }, x, out, pool);
+         for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Sl(k, x[i])); }
+      }
+
+      evaluate([](double x) { return Cl1(x); }, x, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Cl1(x[i])); }
+
+      evaluate([](double x) { return Cl6(x); }, x, out, pool);
+      for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Cl6(x[i])); }
+   }
+
+   SUBCASE("chunk size") {
+      std::vector<double> out(n);
+
+      for (std::size_t chunk: {1, 7, 100000}) {
+         evaluate([](double x) { return Cl2(x); }, x.data(), out.data(), n, pool, chunk);
+         for (std::size_t i = 0; i < n; ++i) { CHECK(out[i] == Cl2(x[i])); }
+      }
+   }
+}
@@ -2,6 +2,7 @@
 
 #include "doctest.h"
 #include "zeta.hpp"
+#include <cmath>
 
 TEST_CASE("test_fixed_values")
 {
@@ -26,3 +27,23 @@ TEST_CASE("test_fixed_values")
    CHECK(zeta(34) == 1.0000000000582077);
    CHECK(zeta(35) == 1.0000000000291039);
 }
+
+TEST_CASE("test_constexpr")
+{
+   using polylogarithm::zeta;
+
+   static_assert(zeta(-2) == 0.0, "zeta(-2) must be a constant expression");
+   static_assert(zeta(0) == -0.5, "zeta(0) must be a constant expression");
+   static_assert(zeta(2) == 1.6449340668482264, "zeta(2) must be a constant expression");
+   static_assert(zeta(40) > 1.0, "zeta(40) must be a constant expression");
+
+   constexpr double z[] = { zeta(3), zeta(-1), zeta(100) };
+
+   CHECK(z[0] == zeta(3));
+   CHECK(z[1] == zeta(-1));
+   CHECK(z[2] == 1.0);
+
+   for (int64_t n = 34; n <= 2000; ++n) {
+      CHECK(zeta(n) == 1.0/(1.0 - std::pow(0.5, n)));
+   }
+}
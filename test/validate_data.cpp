@@ -0,0 +1,334 @@
+// Validates the polylogarithm functions against binary reference data
+// files, created by convert_data from the files in test/data/.
+//
+// The function is determined from the file name: LiN.bin is compared
+// to Li2, ..., Li6 for N = 2,...,6 and to Li(N, z) otherwise, ClN.bin
+// to Cl(N, x) and SlN.bin to Sl(N, x).  The files are memory-mapped
+// and evaluated in parallel.  For each function and each region of
+// arguments the maximum and the mean error in units in the last place
+// (ULP) of the reference value are reported, where reference values
+// below 1 in magnitude are treated as 1.  Real and imaginary parts
+// of complex results are treated separately and the larger error is
+// taken.
+//
+// Usage: validate_data [--threads=<n>] [--max-ulp=[<f>:]<x>]... <file.bin>...
+//
+// If --max-ulp=<x> is given, the program fails if the maximum error of
+// any function exceeds x.  --max-ulp=<f>:<x> sets the limit for the
+// function f only, where f is the stem of the file name, e.g. Li2,
+// Li-5 or Cl1000, and overrides the limit for all functions.
+
+#include "Cl.hpp"
+#include "Li.hpp"
+#include "Sl.hpp"
+#include "mapped_data.hpp"
+#include "parallel.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <complex>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+const double PI = 3.1415926535897932;
+
+/// number of records processed by one task
+const std::size_t CHUNK = 4096;
+
+struct Options {
+   int threads{static_cast<int>(std::thread::hardware_concurrency())};
+   double max_ulp{-1};                     ///< limit for all functions
+   std::map<std::string, double> max_ulp_of; ///< limits per function
+   std::vector<std::string> files;
+};
+
+/// error statistics of one function in one region
+struct Errors {
+   std::size_t count{0};
+   double max{0};
+   double sum{0};
+   std::complex<double> arg_max{}; ///< argument with the maximum error
+
+   void add(double ulp, const std::complex<double>& arg)
+   {
+      count++;
+      sum += ulp;
+      if (ulp > max || std::isnan(ulp)) {
+         max = ulp;
+         arg_max = arg;
+      }
+   }
+
+   void add(const Errors& e)
+   {
+      count += e.count;
+      sum += e.sum;
+      if (e.max > max || std::isnan(e.max)) {
+         max = e.max;
+         arg_max = e.arg_max;
+      }
+   }
+};
+
+const char* const COMPLEX_REGIONS[] = { "|log(z)|<1", "|z|<=1", "|z|>1" };
+const char* const REAL_REGIONS[] = { "x<0", "0<=x<=pi", "pi<x<2pi", "x>=2pi" };
+
+constexpr std::size_t N_REGIONS = 4;
+
+/// one reference data file
+struct Job {
+   std::string function;  ///< "Li", "Cl" or "Sl"
+   int64_t n{};           ///< order
+   std::unique_ptr<polylogarithm::test::MappedData> data;
+   std::vector<std::vector<Errors>> chunks; ///< errors per chunk and region
+
+   std::string name() const { return function + "(" + std::to_string(n) + ")"; }
+   std::string stem() const { return function + std::to_string(n); }
+};
+
+/**
+ * Error of y in units of the last place of the reference value hi + lo.
+ * For |hi| < 1 the error is measured in units of the last place of 1,
+ * i.e. in units of the machine epsilon, as close to the zeros of the
+ * functions the reference value is dominated by the rounding of the
+ * argument to double precision.
+ */
+double ulp_error(double y, double hi, double lo)
+{
+   if (std::isnan(y) || std::isnan(hi)) {
+      return std::isnan(y) && std::isnan(hi) ? 0 : std::numeric_limits<double>::quiet_NaN();
+   }
+   if (std::isinf(y) || std::isinf(hi)) {
+      return y == hi ? 0 : std::numeric_limits<double>::infinity();
+   }
+
+   const double a = std::max(std::abs(hi), 1.0);
+   const double ulp = std::nextafter(a, std::numeric_limits<double>::infinity()) - a;
+
+   return std::abs((y - hi) - lo)/ulp;
+}
+
+std::complex<double> Li(int64_t n, const std::complex<double>& z)
+{
+   switch (n) {
+   case 2: return polylogarithm::Li2(z);
+   case 3: return polylogarithm::Li3(z);
+   case 4: return polylogarithm::Li4(z);
+   case 5: return polylogarithm::Li5(z);
+   case 6: return polylogarithm::Li6(z);
+   default: break;
+   }
+   return polylogarithm::Li(n, z);
+}
+
+std::size_t complex_region(const std::complex<double>& z)
+{
+   if (z != 0.0 && std::norm(std::log(z)) < 1) {
+      return 0;
+   }
+   return std::norm(z) <= 1 ? 1 : 2;
+}
+
+std::size_t real_region(double x)
+{
+   if (x < 0) {
+      return 0;
+   } else if (x <= PI) {
+      return 1;
+   } else if (x < 2*PI) {
+      return 2;
+   }
+   return 3;
+}
+
+/// validates the records of the given chunk of the job
+void validate(Job& job, std::size_t chunk)
+{
+   const std::size_t first = chunk*CHUNK;
+   const std::size_t last = std::min(first + CHUNK, job.data->size());
+   auto& errors = job.chunks[chunk];
+
+   if (job.data->is_complex()) {
+      const auto* r = job.data->complexes();
+      for (std::size_t i = first; i < last; ++i) {
+         const std::complex<double> z(r[i].re, r[i].im);
+         const auto li = Li(job.n, z);
+         const double ulp = std::max(ulp_error(std::real(li), r[i].re_hi, r[i].re_lo),
+                                     ulp_error(std::imag(li), r[i].im_hi, r[i].im_lo));
+         errors[complex_region(z)].add(ulp, z);
+      }
+   } else {
+      const auto* r = job.data->reals();
+      for (std::size_t i = first; i < last; ++i) {
+         const double x = r[i].x;
+         const double y = job.function == "Cl"
+            ? polylogarithm::Cl(job.n, x) : polylogarithm::Sl(job.n, x);
+         errors[real_region(x)].add(ulp_error(y, r[i].hi, r[i].lo), x);
+      }
+   }
+}
+
+/// determines function and order from a file name like path/Li-10.bin
+bool parse_filename(const std::string& filename, std::string& function, int64_t& n)
+{
+   const auto slash = filename.find_last_of("/\\");
+   const std::string base = filename.substr(slash == std::string::npos ? 0 : slash + 1);
+   const auto dot = base.find('.');
+
+   if (base.size() < 3 || dot == std::string::npos) {
+      return false;
+   }
+
+   function = base.substr(0, 2);
+
+   if (function != "Li" && function != "Cl" && function != "Sl") {
+      return false;
+   }
+
+   char* end = nullptr;
+   const std::string num = base.substr(2, dot - 2);
+   n = std::strtoll(num.c_str(), &end, 10);
+
+   return !num.empty() && *end == '\0';
+}
+
+bool starts_with(const std::string& s, const std::string& prefix)
+{
+   return s.compare(0, prefix.size(), prefix) == 0;
+}
+
+void print_usage()
+{
+   std::cout << "Usage: validate_data [--threads=<n>] [--max-ulp=[<f>:]<x>]... <file.bin>...\n";
+}
+
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+   Options opt;
+
+   for (int i = 1; i < argc; ++i) {
+      const std::string arg(argv[i]);
+      if (starts_with(arg, "--threads=")) {
+         opt.threads = std::atoi(arg.substr(10).c_str());
+      } else if (starts_with(arg, "--max-ulp=")) {
+         const std::string value = arg.substr(10);
+         const auto colon = value.find(':');
+         if (colon == std::string::npos) {
+            opt.max_ulp = std::atof(value.c_str());
+         } else {
+            opt.max_ulp_of[value.substr(0, colon)] = std::atof(value.substr(colon + 1).c_str());
+         }
+      } else if (arg == "--help" || arg == "-h") {
+         print_usage();
+         return EXIT_SUCCESS;
+      } else if (starts_with(arg, "--")) {
+         std::cerr << "Error: unknown argument: " << arg << '\n';
+         print_usage();
+         return EXIT_FAILURE;
+      } else {
+         opt.files.push_back(arg);
+      }
+   }
+
+   if (opt.files.empty()) {
+      print_usage();
+      return EXIT_FAILURE;
+   }
+
+   const auto start = std::chrono::steady_clock::now();
+
+   std::vector<Job> jobs(opt.files.size());
+   std::vector<std::pair<std::size_t, std::size_t>> tasks; // (job, chunk)
+
+   try {
+      for (std::size_t j = 0; j < opt.files.size(); ++j) {
+         auto& job = jobs[j];
+         if (!parse_filename(opt.files[j], job.function, job.n)) {
+            std::cerr << "Error: cannot determine function from file name " << opt.files[j] << '\n';
+            return EXIT_FAILURE;
+         }
+         job.data.reset(new polylogarithm::test::MappedData(opt.files[j]));
+         if (job.data->is_complex() != (job.function == "Li")) {
+            std::cerr << "Error: unexpected record type in " << opt.files[j] << '\n';
+            return EXIT_FAILURE;
+         }
+         const std::size_t n_chunks = (job.data->size() + CHUNK - 1)/CHUNK;
+         job.chunks.assign(n_chunks, std::vector<Errors>(N_REGIONS));
+         for (std::size_t c = 0; c < n_chunks; ++c) {
+            tasks.emplace_back(j, c);
+         }
+      }
+   } catch (const std::exception& e) {
+      std::cerr << "Error: " << e.what() << '\n';
+      return EXIT_FAILURE;
+   }
+
+   polylogarithm::parallel::ThreadPool pool(opt.threads > 0 ? opt.threads : 1);
+
+   pool.run(tasks.size(), [&](std::size_t t) {
+      validate(jobs[tasks[t].first], tasks[t].second);
+   });
+
+   const auto stop = std::chrono::steady_clock::now();
+
+   std::cout << std::left << std::setw(12) << "function"
+             << std::setw(14) << "region"
+             << std::right << std::setw(10) << "points"
+             << std::setw(14) << "max ULP"
+             << std::setw(12) << "mean ULP"
+             << "  argument of max\n"
+             << std::string(90, '-') << '\n';
+
+   bool failed = false;
+   std::size_t n_points = 0;
+
+   for (const auto& job: jobs) {
+      const auto it = opt.max_ulp_of.find(job.stem());
+      const double max_ulp = it != opt.max_ulp_of.end() ? it->second : opt.max_ulp;
+
+      for (std::size_t r = 0; r < N_REGIONS; ++r) {
+         Errors e;
+         for (const auto& c: job.chunks) {
+            e.add(c[r]);
+         }
+         if (e.count == 0) {
+            continue;
+         }
+
+         n_points += e.count;
+
+         const bool exceeded = max_ulp >= 0 && !(e.max <= max_ulp);
+         failed = failed || exceeded;
+
+         std::cout << std::left << std::setw(12) << job.name()
+                   << std::setw(14) << (job.data->is_complex() ? COMPLEX_REGIONS[r] : REAL_REGIONS[r])
+                   << std::right << std::setw(10) << e.count
+                   << std::setw(14) << std::setprecision(3) << std::fixed << e.max
+                   << std::setw(12) << e.sum/e.count << "  "
+                   << std::setprecision(17) << std::defaultfloat;
+         if (job.data->is_complex()) {
+            std::cout << e.arg_max;
+         } else {
+            std::cout << std::real(e.arg_max);
+         }
+         std::cout << (exceeded ? "  FAILED" : "") << '\n';
+      }
+   }
+
+   std::cout << "\nvalidated " << n_points << " points in "
+             << std::setprecision(3) << std::chrono::duration<double>(stop - start).count()
+             << " s with " << pool.size() << " threads\n";
+
+   return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}